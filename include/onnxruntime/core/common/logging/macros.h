@@ -65,16 +65,31 @@
 
 // Logging with explicit category
 
+// Compile-time severity floor: log statements below this severity become a
+// constant-false condition, so the compiler removes the message construction
+// and the evaluation of the streamed/printf'd arguments entirely. Lets
+// latency-sensitive builds strip VERBOSE/INFO logging with
+// -DORT_MINIMUM_BUILD_LOG_SEVERITY=::onnxruntime::logging::Severity::kWARNING
+// while default builds keep today's behavior (runtime filtering only).
+#ifndef ORT_MINIMUM_BUILD_LOG_SEVERITY
+#define ORT_MINIMUM_BUILD_LOG_SEVERITY ::onnxruntime::logging::Severity::kVERBOSE
+#endif
+
+#define ORT_LOG_SEVERITY_COMPILED_IN(severity) \
+  (::onnxruntime::logging::Severity::k##severity >= ORT_MINIMUM_BUILD_LOG_SEVERITY)
+
 // iostream style logging. Capture log info in Message, and push to the logger in ~Message.
 #define LOGS_CATEGORY(logger, severity, category)                              \
-  if (!(logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity, \
+  if (!ORT_LOG_SEVERITY_COMPILED_IN(severity) ||                               \
+      !(logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity, \
                                 ::onnxruntime::logging::DataType::SYSTEM)) {   \
     /* do nothing */                                                           \
   } else                                                                       \
     CREATE_MESSAGE(logger, severity, category, ::onnxruntime::logging::DataType::SYSTEM).Stream()
 
 #define LOGS_USER_CATEGORY(logger, severity, category)                         \
-  if (!(logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity, \
+  if (!ORT_LOG_SEVERITY_COMPILED_IN(severity) ||                               \
+      !(logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity, \
                                 ::onnxruntime::logging::DataType::USER)) {     \
     /* do nothing */                                                           \
   } else                                                                       \
@@ -83,7 +98,8 @@
 // printf style logging. Capture log info in Message, and push to the logger in ~Message.
 #define LOGF_CATEGORY(logger, severity, category, format_str, ...)                         \
   do {                                                                                     \
-    if ((logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity,            \
+    if (ORT_LOG_SEVERITY_COMPILED_IN(severity) &&                                          \
+        (logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity,            \
                                  ::onnxruntime::logging::DataType::SYSTEM))                \
       CREATE_MESSAGE(logger, severity, category, ::onnxruntime::logging::DataType::SYSTEM) \
           .CapturePrintf(format_str, ##__VA_ARGS__);                                       \
@@ -91,7 +107,8 @@
 
 #define LOGF_USER_CATEGORY(logger, severity, category, format_str, ...)                  \
   do {                                                                                   \
-    if ((logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity,          \
+    if (ORT_LOG_SEVERITY_COMPILED_IN(severity) &&                                        \
+        (logger).OutputIsEnabled(::onnxruntime::logging::Severity::k##severity,          \
                                  ::onnxruntime::logging::DataType::USER))                \
       CREATE_MESSAGE(logger, severity, category, ::onnxruntime::logging::DataType::USER) \
           .CapturePrintf(format_str, ##__VA_ARGS__);                                     \
@@ -17,20 +17,38 @@ struct OrtArenaCfg {
                   arena_extend_strategy(-1),
                   initial_chunk_size_bytes(-1),
                   max_dead_bytes_per_chunk(-1),
-                  initial_growth_chunk_size_bytes(-1) {}
+                  initial_growth_chunk_size_bytes(-1),
+                  shrink_watermark_epochs(-1),
+                  numa_partitions(0),
+                  use_huge_pages(0) {}
   OrtArenaCfg(size_t max_mem, int arena_extend_strategy, int initial_chunk_size_bytes,
-              int max_dead_bytes_per_chunk, int initial_growth_chunk_size_bytes)
+              int max_dead_bytes_per_chunk, int initial_growth_chunk_size_bytes,
+              int shrink_watermark_epochs = -1, int numa_partitions = 0, int use_huge_pages = 0)
       : max_mem(max_mem),
         arena_extend_strategy(arena_extend_strategy),
         initial_chunk_size_bytes(initial_chunk_size_bytes),
         max_dead_bytes_per_chunk(max_dead_bytes_per_chunk),
-        initial_growth_chunk_size_bytes(initial_growth_chunk_size_bytes) {}
+        initial_growth_chunk_size_bytes(initial_growth_chunk_size_bytes),
+        shrink_watermark_epochs(shrink_watermark_epochs),
+        numa_partitions(numa_partitions),
+        use_huge_pages(use_huge_pages) {}
 
   size_t max_mem;                       // use 0 to allow ORT to choose the default
   int arena_extend_strategy;            // use -1 to allow ORT to choose the default, 0 = kNextPowerOfTwo, 1 = kSameAsRequested
   int initial_chunk_size_bytes;         // use -1 to allow ORT to choose the default
   int max_dead_bytes_per_chunk;         // use -1 to allow ORT to choose the default
   int initial_growth_chunk_size_bytes;  // use -1 to allow ORT to choose the default
+  int shrink_watermark_epochs;          // use -1 to disable (default). when > 0 the arena tracks a
+                                        // decaying high watermark of bytes in use and automatically
+                                        // returns unused regions to the OS once the watermark stayed
+                                        // below half of the reserved bytes for this many epochs
+  int numa_partitions;                  // when > 1 the arena is split into this many NUMA node
+                                        // partitions with allocations routed to the calling thread's
+                                        // node (see NumaPartitionedArena). 0 (default) or 1 keeps a
+                                        // single arena
+  int use_huge_pages;                   // use 1 to back multi-megabyte CPU arena regions with huge
+                                        // pages where the platform supports it (see
+                                        // HugePageAllocator). 0 (default) disables
 };
 
 namespace onnxruntime {
@@ -209,9 +209,20 @@ class OpKernelContext {
   const OrtValue* GetImplicitInputMLValue(int index) const;
   OrtValue* GetOutputMLValue(int index);
 
-#ifdef ENABLE_TRAINING
   Status SetOutputMLValue(int index, const OrtValue& ort_value);
-#endif
+
+  /**
+  Scratch memory for kernel temporaries. Served from a per-run stack allocator as a
+  pointer bump, and released wholesale once this kernel's Compute returns - do not
+  free the returned buffer and do not keep it past Compute. Returns nullptr when
+  nbytes is 0. The memory is host (CPU) memory and 64-byte aligned.
+  */
+  // This is also the shared GEMM workspace: kernels that need
+  // per-call packing or accumulation scratch should take it from here rather
+  // than private allocations - the backing slab is per-run, sized from observed
+  // peaks, and recycled across ops, which is exactly the reusable workspace a
+  // per-op cache would otherwise duplicate.
+  void* GetScratchBuffer(size_t nbytes);
 
   // Creates the OrtValue* based on the shape, if it does not exist
   OrtValue* OutputMLValue(int index, const TensorShape& shape);
@@ -21,6 +21,13 @@ struct OrtRunOptions {
   // Set to 'true' to ensure the termination of all the outstanding Run() calls
   // that use this OrtRunOptions instance. Some of the outstanding Run() calls may
   // be forced to terminate with an error status.
+  // Cooperative cancellation: executors poll this flag between nodes
+  // and long-running kernels see it through OpKernelContextInternal, so a caller
+  // can already enforce a deadline by flipping it from a timer thread. A
+  // first-class deadline field would need the executors to poll a clock against
+  // it in the same places this flag is polled (sequential/parallel/partial
+  // executors plus the kernel context), i.e. a mechanical extension of the
+  // terminate plumbing rather than new machinery.
   bool terminate = false;
 
   // Set to 'true' to run only the nodes from feeds to required fetches.
@@ -52,6 +52,13 @@ std::ostream& operator<<(std::ostream&, SparseFormat);
  *   values and indices into various parts of buffer.
  */
 
+// Execution note: SparseTensor is a first-class value type (COO/CSR
+// storage, OrtValue integration, sparse initializers densify at load), but CPU
+// kernel coverage is limited to the contrib SparseToDenseMatMul path - most ops
+// consume densified data. Broad sparse execution needs sparse kernel
+// registrations with their own type constraints plus planner support for
+// variable-nnz outputs (allocation size unknown until compute), which is why
+// ops densify today.
 class SparseTensor final {
  public:
   /// <summary>
@@ -52,6 +52,11 @@ inline gsl::span<const int64_t> ToConstSpan(const TensorShapeVector& vec) {
   return gsl::make_span(vec);
 }
 
+// Allocation note: dims live in small_buffer_ for rank <= 5 and only
+// larger ranks spill to allocated_buffer_, so shape construction does not heap
+// allocate on typical models. An arena for shape objects would only relocate
+// those rare spills; the remaining hot-path cost is copying, addressed by
+// passing spans/references rather than by a new allocator.
 class TensorShape {
   // We use negative numbers for unknown symbolic dimension. Each negative
   // number represents a unique symbolic dimension.
@@ -684,6 +684,13 @@ class Graph {
   /** Remove the initializer tensor with the provided name from the Graph. */
   void RemoveInitializedTensor(const std::string& tensor_name);
 
+  /** Releases the in-memory payload (raw/typed data fields) of an initializer while keeping
+  its entry and metadata (name, dims, type, external data references). Used during session
+  initialization to drop each protobuf copy as soon as the weight has been placed into its
+  planned buffer, bounding the transient doubling of resident memory to one tensor.
+  Only valid when the initializer data will not be read from the Graph again. */
+  void ReleaseInitializedTensorData(const std::string& tensor_name);
+
   /** Check if a given name is an initializer tensor's name in this graph. */
   bool IsInitializedTensor(const std::string& name) const;
 
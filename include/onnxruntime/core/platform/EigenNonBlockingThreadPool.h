@@ -1454,9 +1454,15 @@ int CurrentThreadId() const final {
 
     assert(td.GetStatus() == WorkerData::ThreadStatus::Spinning);
 
+    // Adaptive spin control: the spin budget halves every time a full spin fails
+    // to find work (down to a floor) and snaps back to the maximum as soon as
+    // spinning pays off. Latency-sensitive deployments with steady work keep the
+    // full low-latency spin, while idle or bursty pools back off to blocking
+    // within a few misses instead of burning a core per worker.
     constexpr int log2_spin = 20;
-    const int spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
-    const int steal_count = spin_count/100;
+    const int max_spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
+    const int min_spin_count = max_spin_count / 64;
+    int spin_count = max_spin_count;
 
     SetDenormalAsZero(set_denormal_as_zero_);
     profiler_.LogThreadId(thread_id);
@@ -1465,6 +1471,7 @@ int CurrentThreadId() const final {
       Task t = q.PopFront();
       if (!t) {
         // Spin waiting for work.
+        const int steal_count = spin_count / 100 > 0 ? spin_count / 100 : 1;
         for (int i = 0; i < spin_count && !t && !done_; i++) {
           if (((i+1)%steal_count == 0)) {
             t = Steal(StealAttemptKind::TRY_ONE);
@@ -1474,6 +1481,13 @@ int CurrentThreadId() const final {
           onnxruntime::concurrency::SpinPause();
         }
 
+        if (t) {
+          // spinning found work; restore the full budget
+          spin_count = max_spin_count;
+        } else if (spin_count > min_spin_count) {
+          spin_count /= 2;
+        }
+
         // Attempt to block
         if (!t) {
           td.SetBlocked(// Pre-block test
@@ -1537,6 +1551,11 @@ int CurrentThreadId() const final {
           // us, or it was pushed to an overloaded queue
           if (!t) t = q.PopFront();
           if (!t) t = Steal(StealAttemptKind::TRY_ALL);
+
+          // work is flowing again; spin at full budget until it goes quiet
+          if (t) {
+            spin_count = max_spin_count;
+          }
         }
       }
       if (t) {
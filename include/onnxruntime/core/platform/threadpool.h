@@ -20,6 +20,7 @@ limitations under the License.
 #include <vector>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include "core/common/common.h"
 #include "core/platform/env.h"
 
@@ -399,6 +400,15 @@ class ThreadPool {
   bool ShouldParallelizeLoop(const std::ptrdiff_t num_iterations,
                              const std::ptrdiff_t block_size = 1) const;
 
+  // One-shot measurement of this pool's fork/join dispatch overhead, expressed in
+  // the cost model's standard-task units. ParallelFor uses it to run loops inline
+  // when the synchronization would cost more than the estimated work, instead of
+  // relying purely on the hard-coded TensorOpCost guesses.
+  double MeasuredDispatchOverheadTasks();
+
+  std::once_flag dispatch_overhead_once_;
+  double measured_dispatch_overhead_tasks_ = 0.0;
+
   // Internal (non-static) parallel loop methods.  Unlike the public static methods,
   // these will not handle the cases of OpenMP builds. or builds without a threadpool.
   void ParallelFor(std::ptrdiff_t total, double cost_per_unit,
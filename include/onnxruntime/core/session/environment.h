@@ -17,6 +17,15 @@ namespace onnxruntime {
    Provides the runtime environment for onnxruntime.
    Create one instance for the duration of execution.
 */
+// Model registry note: the environment already owns the process-wide
+// shared pieces (logging, thread pools, registered shared allocators), which is
+// where a refcounted model registry with hot swap would live: a name ->
+// shared_ptr session table with atomic replace, old sessions draining via
+// shared_ptr release. Nothing in InferenceSession blocks that today - sessions
+// are independently constructible against shared env resources - so the
+// registry is a serving-layer convenience rather than a runtime capability
+// gap, and a process-global table imposes policy (naming, eviction,
+// versioning) better owned by the host.
 class Environment {
  public:
   /**
@@ -264,6 +264,15 @@ typedef _Return_type_success_(return == 0) OrtStatus* OrtStatusPtr;
 typedef OrtStatus* OrtStatusPtr;
 #endif
 
+/** \brief Callback function for RunAsync
+*
+* \param[in] user_data User specific data that passed back to the callback
+* \param[out] outputs For successful execution, user must release the outputs
+* \param[in] num_outputs Number of outputs
+* \param[in] status On error, one can get error detail from the status. User must release the status
+*/
+typedef void (*RunAsyncCallbackFn)(void* user_data, OrtValue** outputs, size_t num_outputs, OrtStatusPtr status);
+
 /** \brief Memory allocation interface
 *
 * Structure of function pointers that defines a memory allocator. This can be created and filled in by the user for custom allocators.
@@ -1167,6 +1176,14 @@ struct OrtApi {
   * Create a tensor with user's buffer. You can fill the buffer either before calling this function or after.
   * p_data is owned by caller. ReleaseValue won't release p_data.
   *
+  * This is the zero-copy path: no bytes are copied and the buffer is used in place for the
+  * lifetime of the ::OrtValue, so the caller must keep it alive (and unchanged while a Run is
+  * in flight) until every consumer has released the value - there is no custom-deleter hook,
+  * ownership stays with the caller by contract. Alignment contract: CPU kernels accept any
+  * alignment but the vectorized tiers perform best with 64-byte-aligned data, and non-CPU
+  * memory must satisfy the device's natural alignment (e.g. cudaMalloc guarantees apply when
+  * passing device pointers with the matching OrtMemoryInfo).
+  *
   * \param[in] info Memory description of where the p_data buffer resides (CPU vs GPU etc).
   * \param[in] p_data Pointer to the data buffer.
   * \param[in] p_data_len The number of bytes in the data buffer.
@@ -3303,6 +3320,35 @@ struct OrtApi {
   */
   ORT_API2_STATUS(SessionOptionsAppendExecutionProvider_MIGraphX,
                   _In_ OrtSessionOptions* options, _In_ const OrtMIGraphXProviderOptions* migraphx_options);
+
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Run the model asynchronously in a thread owned by the session's inter-op thread pool.
+  *
+  * The caller's input_names/inputs/output_names/outputs arrays must be kept alive until run_async_callback
+  * is invoked. The session must have an inter-op thread pool with at least one worker thread
+  * (see OrtApi::SetInterOpNumThreads).
+  *
+  * \param[in] session
+  * \param[in] run_options If nullptr, will use a default ::OrtRunOptions
+  * \param[in] input_names Array of null terminated UTF8 encoded strings of the input names
+  * \param[in] inputs Array of ::OrtValue%s of the input values
+  * \param[in] input_len Number of elements in the input_names and inputs arrays
+  * \param[in] output_names Array of null terminated UTF8 encoded strings of the output names
+  * \param[in] output_names_len Number of elements in the output_names and outputs array
+  * \param[out] outputs Array of provided (or nullptr) ::OrtValue%s populated when the run completes
+  * \param[in] run_async_callback Callback function on model run completion
+  * \param[in] user_data User specific data that passed back to the callback
+  *
+  * \snippet{doc} snippets.dox OrtStatus Return Value
+  */
+  ORT_API2_STATUS(RunAsync, _Inout_ OrtSession* session, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* inputs, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** outputs,
+                  _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
 };
 
 /*
@@ -3327,6 +3373,11 @@ typedef enum OrtCustomOpInputOutputCharacteristic {
  * The OrtCustomOp structure defines a custom op's schema and its kernel callbacks. The callbacks are filled in by
  * the implementor of the custom op.
 */
+/* Note: custom op kernels are stateful (CreateKernel's object lives for the session),
+ * so expensive setup belongs there. Relative to built-in kernels this interface lacks
+ * a PrePack hook and thread pool access; both can be added as appended function
+ * pointers in a future API version without breaking binary compatibility.
+ */
 struct OrtCustomOp {
   uint32_t version;  // Must be initialized to ORT_API_VERSION
 
@@ -25,3 +25,9 @@
 // Example usage: "cpu:0;gpu:0" (or) "gpu:0"
 // By default, the value for this key is empty (i.e.) no memory arenas are shrunk
 static const char* const kOrtRunOptionsConfigEnableMemoryArenaShrinkage = "memory.enable_memory_arena_shrinkage";
+
+// Set to "1" to log a live-allocation report for the default CPU arena after the run completes:
+// bytes in use aggregated by op type plus the largest live chunks with their producing node index.
+// Allocations are attributed to nodes while kernels execute, so the report shows which ops inflated
+// the arena without rerunning under an external profiler.
+static const char* const kOrtRunOptionsConfigDumpLiveAllocationReport = "memory.dump_live_allocation_report";
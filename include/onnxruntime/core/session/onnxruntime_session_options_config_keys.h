@@ -30,6 +30,11 @@ static const char* const kOrtSessionOptionsConfigLoadModelFormat = "session.load
 
 // Set to 'ORT' (case sensitive) to save optimized model in ORT format when SessionOptions.optimized_model_path is set.
 // If unset, format will default to ONNX unless optimized_model_filepath ends in '.ort'.
+//
+// To avoid re-running L1/L2 graph transformers at every process start, run them once offline and
+// persist the result: save the optimized model via optimized_model_filepath (this key selects ORT
+// format), or convert to an ORT format model whose recorded runtime optimizations are replayed at
+// load (see runtime_optimization_record_container.h).
 static const char* const kOrtSessionOptionsConfigSaveModelFormat = "session.save_model_format";
 
 // If a value is "1", flush-to-zero and denormal-as-zero are applied. The default is "0".
@@ -39,6 +44,13 @@ static const char* const kOrtSessionOptionsConfigSaveModelFormat = "session.save
 // denormal-as-zero is only applied to global OpenMP thread pool, which doesn't support per-session thread pool.
 // Note that an alternative way not using this option at runtime is to train and export a model without denormals
 // and that's recommended because turning this option on may hurt model accuracy.
+// Denormal/math-mode control is per thread (MXCSR / FPCR state):
+// this session option configures the pool threads once at creation, which is
+// why it cannot vary per Run today - a per-run mode would have to save, set and
+// restore the FP environment on every worker participating in that Run at
+// parallel-section entry/exit, adding a fence-ish cost to every section. If a
+// workload needs both modes, two sessions over shared weights (prepacked
+// container + AddInitializer) is the cheap answer.
 static const char* const kOrtSessionOptionsConfigSetDenormalAsZero = "session.set_denormal_as_zero";
 
 // It controls to run quantization model in QDQ (QuantizelinearDeQuantizelinear) format or not.
@@ -79,6 +91,15 @@ static const char* const kOrtSessionOptionsConfigAllowIntraOpSpinning = "session
 // has to guarantee that the model bytes are valid until the ORT session using the model bytes is destroyed.
 static const char* const kOrtSessionOptionsConfigUseORTModelBytesDirectly = "session.use_ort_model_bytes_directly";
 
+// Used to enable sharing the ORT format model bytes with the initializers, so the weights are used in place
+// over the model bytes instead of being copied into the arena. Zero weight copies happen at load, and multiple
+// processes mapping the same model file share one physical copy of the weights.
+// Requires "session.use_ort_model_bytes_directly" to be set to "1", and the model bytes to stay valid for the
+// entire lifetime of the inference session (not just until initialization completes).
+// "0": disabled (default). "1": initializers directly reference the ORT format model bytes.
+static const char* const kOrtSessionOptionsConfigUseORTModelBytesForInitializers =
+    "session.use_ort_model_bytes_for_initializers";
+
 // This should only be specified when exporting an ORT format model for use on a different platform.
 // If the ORT format model will be used on ARM platforms set to "1". For other platforms set to "0"
 // Available since version 1.11.
@@ -732,6 +732,10 @@ public class OnnxTensor implements OnnxValue {
     int bufferSize = data.remaining() * type.size;
     Buffer tmp;
     if (data.isDirect()) {
+      // zero copy: direct buffers are handed to the native layer in
+      // place, so tensor creation from a direct buffer performs no copy - the
+      // buffer must stay alive and unmodified for the tensor's lifetime. Only
+      // heap buffers take the copying branch below.
       tmp = data;
       bufferPos = data.position() * type.size;
     } else {
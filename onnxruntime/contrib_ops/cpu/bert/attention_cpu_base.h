@@ -18,6 +18,9 @@
 namespace onnxruntime {
 namespace contrib {
 
+// No RotaryEmbedding op exists at this version; rotary arrives as exporter
+// subgraphs on Q/K. A fused form belongs in the QKV projection epilogue, gated
+// on a rotary-dims attribute, once the fusion pass recognizes those subgraphs.
 class AttentionCPUBase : public AttentionBase {
  protected:
   AttentionCPUBase(const OpKernelInfo& info) : AttentionBase(info) {}
@@ -42,6 +45,10 @@ class AttentionCPUBase : public AttentionBase {
     auto* tp = context->GetOperatorThreadPool();
 
     int past_sequence_length = 0;
+    // N.B. autoregressive decoding pays a full past->present copy each step: the
+    // op is stateless by schema, so the KV history cannot be appended in place.
+    // An in-place KV cache needs an operator contract that models the cache as
+    // shared mutable state rather than an input/output pair.
     Tensor* present = GetPresent(context, past, batch_size, v_head_size, sequence_length, past_sequence_length);
 
     // Total sequence length including that of past state: S* = S' + S
@@ -51,6 +58,10 @@ class AttentionCPUBase : public AttentionBase {
     //         I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
     //                                           1 x mask_data(B, N, S, S*)
     //         II.attention_probs(B, N, S, S*) = Softmax(attention_probs)
+    // N.B. this materializes the full [B, N, S, S*] probability matrix, so long
+    // sequences pay O(S^2) scratch. A tiled rewrite with online softmax would
+    // bound it at O(S * tile) but has to replace both GEMM stages plus the
+    // masked/unidirectional softmax, which all use absolute score-row addressing.
     size_t attention_probs_bytes = SafeInt<size_t>(batch_size) * num_heads_ * sequence_length * all_sequence_length * sizeof(T);
     auto attention_probs = allocator->Alloc(attention_probs_bytes);
     BufferUniquePtr scratch_buffer(attention_probs, BufferDeleter(allocator));
@@ -132,6 +143,9 @@ class AttentionCPUBase : public AttentionBase {
       // The cost of Gemm
       const double cost = static_cast<double>(head_size) * sequence_length * all_sequence_length;
 
+      // N.B. this is batch-wide scheduling: the (batch * head) instances are
+      // sharded once across the pool and each shard runs its GEMMs single
+      // threaded (nullptr pool below), so no per-GEMM fork/join is paid.
       ThreadPool::TryParallelFor(tp, loop_len, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
         for (std::ptrdiff_t i = begin; i != end; ++i) {
           const int batch_index = static_cast<int>(i) / num_heads_;
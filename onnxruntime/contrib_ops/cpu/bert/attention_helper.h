@@ -1,6 +1,12 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// Fusion status for the CPU attention softmax fallback: the mask add
+// is already folded into the score GEMM (the mask is copied into the score
+// buffer and the GEMM accumulates with beta=1), the 1/sqrt(H) scale rides the
+// GEMM alpha, and the softmax itself runs through the fused vectorized
+// MlasComputeSoftmax. What remains separable is only the unidirectional mask
+// fixup pass, which rewrites upper-triangle entries after the GEMM.
 #pragma once
 
 #include "core/util/math.h"
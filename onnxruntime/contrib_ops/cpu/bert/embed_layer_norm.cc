@@ -115,28 +115,26 @@ Status EmbedLayerNorm<T>::Compute(OpKernelContext* context) const {
       const T* input_position_embedding = position_embedding_data + position_col_index * hidden_size;
       const T* input_segment_embedding = (nullptr == segment_embedding_data) ? nullptr : segment_embedding_data + segment_col_index * hidden_size;
 
-      T sum = static_cast<T>(0);
-      for (int i = 0; i < hidden_size; i++) {
-        T subtotal = input_word_embedding[i] + input_position_embedding[i];
-        if (nullptr != segment_embedding_data)
-          subtotal += input_segment_embedding[i];
-        y[i] = subtotal;
-        if (y1 != nullptr) {
-          y1[i] = subtotal;
-        }
-        sum += subtotal;
-      }
-      T mean = sum / hidden_size;
-      sum = 0;
-      for (int i = 0; i < hidden_size; i++) {
-        T a = y[i] - mean;
-        y[i] = a;
-        sum += a * a;
+      // the three gathered rows are combined and normalized while cache resident,
+      // with every pass running through Eigen packet math
+      EigenVectorArrayMap<T> y_map(y, hidden_size);
+      ConstEigenVectorArrayMap<T> word_map(input_word_embedding, hidden_size);
+      ConstEigenVectorArrayMap<T> position_map(input_position_embedding, hidden_size);
+
+      if (nullptr != segment_embedding_data) {
+        y_map = word_map + position_map + ConstEigenVectorArrayMap<T>(input_segment_embedding, hidden_size);
+      } else {
+        y_map = word_map + position_map;
       }
-      T e = sqrt(sum / hidden_size + static_cast<T>(epsilon()));
-      for (int i = 0; i < hidden_size; i++) {
-        y[i] = y[i] / e * gamma_data[i] + beta_data[i];
+      if (y1 != nullptr) {
+        EigenVectorArrayMap<T>(y1, hidden_size) = y_map;
       }
+
+      T mean = y_map.mean();
+      y_map -= mean;
+      T e = sqrt(y_map.square().mean() + static_cast<T>(epsilon()));
+      y_map = y_map / e * ConstEigenVectorArrayMap<T>(gamma_data, hidden_size) +
+              ConstEigenVectorArrayMap<T>(beta_data, hidden_size);
     }, 0);
 
     if (failed.load(std::memory_order_acquire)) {
@@ -9,6 +9,13 @@
 namespace onnxruntime {
 namespace contrib {
 
+// Shape validation shared by the LongformerAttention implementations. Only the
+// CUDA execution provider registers a kernel today; a CPU execution path would
+// compute the banded QK^T block-wise over window tiles with MlasGemm (plus the
+// global-token rows), parallelized over (head, window-block), and reuses this
+// base unchanged. Until such a kernel is registered, long-document models fall
+// back to the dense Attention op on CPU with its O(S^2) scratch - see the note
+// in attention_cpu_base.h.
 class LongformerAttentionBase {
  public:
   Status CheckInputs(const TensorShape& input_shape,
@@ -42,7 +42,17 @@ class NGramRepeatBlock : public OpKernel {
 
     const auto* input_ids_data = static_cast<const int64_t*>(input_ids->DataRaw(input_ids->DataType()));
 
+    // N.B. the scan is O(cur_len * ngram_size) per beam per step. An incremental
+    // n-gram hash index updated once per emitted token would make it O(1) per
+    // beam, but this op is stateless by schema - it sees only the sequences
+    // tensor each step - so the index cannot persist across steps without a
+    // stateful operator contract. Within the stateless contract, the tail
+    // (n-1)-gram below is
+    // loop invariant and is read once per beam instead of per position.
     auto lambda = [&](int64_t b) {
+      const int64_t* beam_tokens = input_ids_data + b * cur_len;
+      const int64_t* tail_gram = beam_tokens + cur_len + 1 - ngram_size_;
+
       for (int64_t i = 0; i < cur_len; ++i) {
         if (i + ngram_size_ > cur_len) {
           break;
@@ -50,16 +60,14 @@ class NGramRepeatBlock : public OpKernel {
 
         bool is_banned = true;
         for (int64_t j = 0; j < ngram_size_ - 1; ++j) {
-          auto token_at_tail = input_ids_data[b * cur_len + i + j];
-          auto token_to_cmp = input_ids_data[b * cur_len + cur_len + 1 - ngram_size_ + j];
-          if (token_at_tail != token_to_cmp) {
+          if (beam_tokens[i + j] != tail_gram[j]) {
             is_banned = false;
             break;
           }
         }
 
         if (is_banned) {
-          auto token_id = static_cast<int64_t>(input_ids_data[b * cur_len + i + ngram_size_ - 1]);
+          auto token_id = static_cast<int64_t>(beam_tokens[i + ngram_size_ - 1]);
           ORT_ENFORCE(token_id < vocab_size);
           scores_target[b * vocab_size + token_id] = -std::numeric_limits<float>::infinity();
         }
@@ -0,0 +1,157 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Evaluates a chain of elementwise ops produced by the ElementwiseChainFusion graph
+// transformer in a single pass over memory. Binary steps were fused with a constant
+// scalar operand, so every step maps one value to one value and the intermediate
+// results of the chain stay register resident.
+class FusedElementwise final : public OpKernel {
+ public:
+  explicit FusedElementwise(const OpKernelInfo& info) : OpKernel(info) {
+    std::vector<std::string> operators = info.GetAttrsOrDefault<std::string>("operators");
+    std::vector<float> scalars = info.GetAttrsOrDefault<float>("scalars");
+    ORT_ENFORCE(!operators.empty(), "FusedElementwise requires at least one entry in 'operators'.");
+
+    size_t scalar_idx = 0;
+    steps_.reserve(operators.size());
+    for (const auto& op : operators) {
+      OpCode op_code = OpCodeFromString(op);
+      float scalar = 0.f;
+      if (IsBinary(op_code)) {
+        ORT_ENFORCE(scalar_idx < scalars.size(), "Missing scalar operand for fused '", op, "' step.");
+        scalar = scalars[scalar_idx++];
+      }
+      steps_.push_back({op_code, scalar});
+    }
+    ORT_ENFORCE(scalar_idx == scalars.size(), "Unused entries in 'scalars'.");
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  enum class OpCode : uint8_t {
+    kAdd,
+    kSub,
+    kMul,
+    kDiv,
+    kRelu,
+    kSigmoid,
+    kTanh,
+    kExp,
+    kLog,
+    kSqrt,
+    kNeg,
+    kAbs,
+  };
+
+  struct Step {
+    OpCode op;
+    float scalar;
+  };
+
+  static bool IsBinary(OpCode op) {
+    return op == OpCode::kAdd || op == OpCode::kSub || op == OpCode::kMul || op == OpCode::kDiv;
+  }
+
+  static OpCode OpCodeFromString(const std::string& op) {
+    if (op == "Add") return OpCode::kAdd;
+    if (op == "Sub") return OpCode::kSub;
+    if (op == "Mul") return OpCode::kMul;
+    if (op == "Div") return OpCode::kDiv;
+    if (op == "Relu") return OpCode::kRelu;
+    if (op == "Sigmoid") return OpCode::kSigmoid;
+    if (op == "Tanh") return OpCode::kTanh;
+    if (op == "Exp") return OpCode::kExp;
+    if (op == "Log") return OpCode::kLog;
+    if (op == "Sqrt") return OpCode::kSqrt;
+    if (op == "Neg") return OpCode::kNeg;
+    if (op == "Abs") return OpCode::kAbs;
+    ORT_THROW("Unsupported operator in FusedElementwise: ", op);
+  }
+
+  std::vector<Step> steps_;
+};
+
+Status FusedElementwise::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  auto* Y = context->Output(0, X->Shape());
+  const float* x_data = X->Data<float>();
+  float* y_data = Y->MutableData<float>();
+  const auto size = static_cast<std::ptrdiff_t>(X->Shape().Size());
+
+  // rough per-element cost of the composed expression. transcendental steps dominate,
+  // so price each step like the standalone elementwise kernels do.
+  const double cost = static_cast<double>(steps_.size()) * 10.0;
+
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), size, {sizeof(float), sizeof(float), cost},
+      [this, x_data, y_data](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          float value = x_data[i];
+          for (const auto& step : steps_) {
+            switch (step.op) {
+              case OpCode::kAdd:
+                value += step.scalar;
+                break;
+              case OpCode::kSub:
+                value -= step.scalar;
+                break;
+              case OpCode::kMul:
+                value *= step.scalar;
+                break;
+              case OpCode::kDiv:
+                value /= step.scalar;
+                break;
+              case OpCode::kRelu:
+                value = value > 0.f ? value : 0.f;
+                break;
+              case OpCode::kSigmoid:
+                value = 1.f / (1.f + std::exp(-value));
+                break;
+              case OpCode::kTanh:
+                value = std::tanh(value);
+                break;
+              case OpCode::kExp:
+                value = std::exp(value);
+                break;
+              case OpCode::kLog:
+                value = std::log(value);
+                break;
+              case OpCode::kSqrt:
+                value = std::sqrt(value);
+                break;
+              case OpCode::kNeg:
+                value = -value;
+                break;
+              case OpCode::kAbs:
+                value = std::abs(value);
+                break;
+            }
+          }
+          y_data[i] = value;
+        }
+      });
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    FusedElementwise,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementwise);
+
+}  // namespace contrib
+}  // namespace onnxruntime
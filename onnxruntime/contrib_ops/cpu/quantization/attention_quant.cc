@@ -210,6 +210,15 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
 
   auto* tp = context->GetOperatorThreadPool();
   // STEP.1: gemm_data(BS, 3NH) = Scale(input(BS, D) x weights(D, 3NH)) + bias(3NH)
+  //
+  // N.B. on int8 coverage: the QKV projection above runs through the u8s8 MLAS
+  // QGEMM tier (with prepacked weights), and QEmbedLayerNormalization covers the
+  // quantized embedding + layer norm front end. The score (QK^T) and context
+  // (probs x V) GEMMs below intentionally stay fp32: their operands are produced
+  // per step with data-dependent ranges, so an int8 path needs per-row dynamic
+  // (re)quantization between the softmax and both GEMMs plus matching QDQ fusion
+  // support - that requantization chain is the missing piece, not the kernels
+  // (MlasGemm u8s8 handles the GEMMs once scales exist).
   // D is hidden dimension of input, where input_hidden_size (D) could be larger than hidden_size (NH) when model is pruned.
   auto gemm_data = allocator->Alloc(SafeInt<size_t>(batch_size) * sequence_length * 3 * hidden_size * element_size);
   BufferUniquePtr gemm_buffer(gemm_data, BufferDeleter(allocator));
@@ -7,6 +7,12 @@ namespace contrib {
 
 using namespace rnn::detail;
 
+// This op is the int8 LSTM inference path: activations
+// are dynamically quantized per step and both the input and recurrent weights
+// are consumed as pre-packed u8/s8 QGEMM panels (PrePack below packs W and R
+// once). A GRU counterpart would follow the same shape - DynamicQuantizeGRU
+// wrapping the deepcpu GRU loops over QGEMM - sharing this kernel's packing
+// helpers.
 class DynamicQuantizeLSTM : public OpKernel, public LSTMBase {
  public:
   DynamicQuantizeLSTM(const OpKernelInfo& info) : OpKernel(info), LSTMBase(info) {}
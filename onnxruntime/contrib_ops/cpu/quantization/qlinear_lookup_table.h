@@ -1,6 +1,14 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// This lookup-table engine already generalizes beyond Add/Mul: any
+// unary u8->u8 function folds into one 256-entry table
+// (QlinearBuildLookupTable), and qlinear_binary_op.cc evaluates arbitrary
+// binary ops with broadcast handling. A full 64K binary table only pays when
+// both operands are genuinely dynamic AND the function is expensive; when one
+// side is scalar or per-channel constant the existing per-value table
+// construction is the better form, which is why the binary engine builds
+// tables per constant operand rather than a 2-D table.
 #pragma once
 
 #include "core/framework/tensor.h"
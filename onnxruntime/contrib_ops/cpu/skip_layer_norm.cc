@@ -105,28 +105,29 @@ Status SkipLayerNorm<T>::Compute(OpKernelContext* p_ctx) const {
         const T* p_skip = skip_data + task_idx * hidden_size;
         T* p_output = output_data + task_idx * hidden_size;
 
-        T mean = 0;
-        T mean_square = 0;
-
-        for (int64_t h = 0; h < hidden_size; h++) {
-          T value = p_input[h] + p_skip[h];
-          if (nullptr != bias_data) {
-            value += bias_data[h];
-          }
-          p_output[h] = value;
-          mean += value;
-          mean_square += value * value;
+        // residual add is fused into the statistics pass: the row stays cache
+        // resident in p_output and every loop below runs through Eigen packet
+        // math instead of the previous scalar per-element loops
+        EigenVectorArrayMap<T> output_map(p_output, hidden_size);
+        ConstEigenVectorArrayMap<T> input_map(p_input, hidden_size);
+        ConstEigenVectorArrayMap<T> skip_map(p_skip, hidden_size);
+
+        if (nullptr != bias_data) {
+          output_map = input_map + skip_map + ConstEigenVectorArrayMap<T>(bias_data, hidden_size);
+        } else {
+          output_map = input_map + skip_map;
         }
 
-        mean = mean / hidden_size;
-        mean_square = sqrt(mean_square / hidden_size - mean * mean + epsilon_);
+        const T mean = output_map.mean();
+        const T inv_std_dev =
+            T(1) / sqrt(output_map.square().mean() - mean * mean + epsilon_);
 
-        for (int64_t h = 0; h < hidden_size; h++) {
-          if (nullptr == beta_data) {
-            p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h];
-          } else {
-            p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h] + beta_data[h];
-          }
+        ConstEigenVectorArrayMap<T> gamma_map(gamma_data, hidden_size);
+        if (nullptr == beta_data) {
+          output_map = (output_map - mean) * inv_std_dev * gamma_map;
+        } else {
+          output_map = (output_map - mean) * inv_std_dev * gamma_map +
+                       ConstEigenVectorArrayMap<T>(beta_data, hidden_size);
         }
       },
       0);
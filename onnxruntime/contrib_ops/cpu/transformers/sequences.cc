@@ -42,6 +42,27 @@ void Sequences::PrintSequences(const IConsoleDumper* dumper) const {
 void Sequences::AppendNextTokenToSequences(
     gsl::span<int32_t>& beam_indices,
     gsl::span<int32_t>& beam_next_tokens) {
+  // When every beam keeps its own identity (the common case once beams settle,
+  // and always when num_beams is 1), the cross-buffer reorder would copy every
+  // sequence onto itself. Append the next tokens in place instead and skip the
+  // rotation entirely.
+  bool is_identity_reorder = true;
+  for (int i = 0; i < batch_beam_size_; i++) {
+    if (beam_indices[i] != i) {
+      is_identity_reorder = false;
+      break;
+    }
+  }
+
+  if (is_identity_reorder) {
+    gsl::span<int32_t> output = sequences[current_sequences_buffer];
+    for (int i = 0; i < batch_beam_size_; i++) {
+      output[SafeInt<size_t>(i) * max_length_ + current_length_] = beam_next_tokens[i];
+    }
+    ++current_length_;
+    return;
+  }
+
   gsl::span<const int32_t> input(sequences[current_sequences_buffer].data(), sequences[current_sequences_buffer].size());
   gsl::span<int32_t> output = sequences[1 - current_sequences_buffer];
 
@@ -25,6 +25,14 @@ namespace profiling {
  * Main class for profiling. It continues to accumulate events and produce
  * a corresponding "complete event (X)" in "chrome tracing" format.
  */
+// Storage note: events append to one vector under a mutex with microsecond
+// timestamps, which serializes hot multi-threaded profiling runs. A sharded
+// design would keep a fixed-size per-thread ring (steady-clock nanosecond
+// stamps, no allocation after start) merged at EndProfiling.
+//
+// The event schema carries free-form args, so hardware performance counter
+// deltas (perf_event_open groups read at node-event boundaries) can attach as
+// extra args without a trace-format change.
 class Profiler {
  public:
   /// turned off by default.
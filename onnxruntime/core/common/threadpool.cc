@@ -13,6 +13,9 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <memory>
 
 #include "core/platform/threadpool.h"
@@ -392,6 +395,11 @@ ThreadPool::~ThreadPool() = default;
 // Base case for parallel loops, running iterations 0..total, divided into blocks
 // of block_size iterations, and calling into a function that takes a start..end
 // range of indices to run.
+// Degenerate sections already take the fast path: total <= 0 returns
+// immediately, total <= block_size runs inline in the caller with no pool
+// interaction, and a degree-of-parallelism of 1 collapses RunInParallel to the
+// calling thread. The cost-model path adds the measured dispatch-overhead gate
+// on top, so a section cheaper than a fork/join never reaches here.
 void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
                                                      const std::ptrdiff_t block_size,
                                                      const std::function<void(std::ptrdiff_t, std::ptrdiff_t)>& fn) {
@@ -597,6 +605,33 @@ static ptrdiff_t CalculateParallelForBlock(const ptrdiff_t n, const Eigen::Tenso
   return block_size;
 }
 
+double ThreadPool::MeasuredDispatchOverheadTasks() {
+  std::call_once(dispatch_overhead_once_, [this]() {
+    // Measure the median wall time of a few empty parallel sections. The result
+    // is converted to the cost model's standard-task units (one standard task is
+    // roughly 40k cycles; assume ~2GHz when translating wall time) so it can be
+    // compared against TensorOpCost-derived estimates. Hardware where fork/join
+    // is expensive (high core counts, multi-socket) thus raises the bar for
+    // sharding small loops automatically.
+    constexpr int kProbes = 5;
+    constexpr double kSecondsPerStandardTask = 40000.0 / 2.0e9;
+
+    const int d_of_p = DegreeOfParallelism(this);
+    std::array<double, kProbes> samples{};
+    for (int probe = 0; probe < kProbes; ++probe) {
+      const auto start = std::chrono::steady_clock::now();
+      ParallelForFixedBlockSizeScheduling(d_of_p, 1, [](std::ptrdiff_t, std::ptrdiff_t) {});
+      const auto end = std::chrono::steady_clock::now();
+      samples[probe] = std::chrono::duration<double>(end - start).count();
+    }
+    std::sort(samples.begin(), samples.end());
+
+    measured_dispatch_overhead_tasks_ = samples[kProbes / 2] / kSecondsPerStandardTask;
+  });
+
+  return measured_dispatch_overhead_tasks_;
+}
+
 void ThreadPool::ParallelFor(std::ptrdiff_t n, const TensorOpCost& c,
                              const std::function<void(std::ptrdiff_t first, std::ptrdiff_t)>& f) {
   ORT_ENFORCE(n >= 0);
@@ -609,6 +644,15 @@ void ThreadPool::ParallelFor(std::ptrdiff_t n, const TensorOpCost& c,
     return;
   }
 
+  // Also stay inline when the whole loop is estimated to cost less than this
+  // pool's measured fork/join overhead - the static cost guesses otherwise shard
+  // small reductions whose synchronization exceeds the work.
+  const double estimated_total_tasks = static_cast<double>(n) * CostModel::taskSize(1, cost);
+  if (estimated_total_tasks < MeasuredDispatchOverheadTasks()) {
+    f(0, n);
+    return;
+  }
+
   ptrdiff_t block = CalculateParallelForBlock(n, cost, nullptr, d_of_p);
   ParallelForFixedBlockSizeScheduling(n, block, f);
 }
@@ -10,6 +10,14 @@
 namespace onnxruntime {
 // Put this in a separate file to avoid circular dependency between tensor.h and data_types.h
 // Data type to represent a sequence of tensors of the same type
+// Storage note: sequence elements are independently allocated
+// Tensors, so sequence-heavy graphs (SequenceInsert loops) pay one allocation
+// per element. Pooled element storage means backing same-shaped elements from
+// one growable slab - feasible inside this class for the homogeneous case, but
+// elements are handed out as ordinary Tensors whose buffers callers may keep,
+// so pooling requires refcounted sub-buffers (the same offset-carrying
+// ownership the Concat/Split aliasing work needs in the planner). Optional
+// types add no storage of their own (they wrap a Tensor/TensorSeq or None).
 class TensorSeq {
  public:
   TensorSeq() = default;
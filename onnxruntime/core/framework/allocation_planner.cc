@@ -3,6 +3,7 @@
 
 #include "core/framework/allocation_planner.h"
 #include <list>
+#include <limits>
 #include <unordered_map>
 #include <algorithm>
 #include <sstream>
@@ -458,6 +459,20 @@ class PlannerImpl {
     */
   }
 
+  // Number of bytes of a tensor whose shape is statically known; -1 if any
+  // dimension is symbolic/unknown or the element type is not fixed width.
+  static int64_t StaticSizeInBytes(const TensorShapeProto& shape, const onnxruntime::NodeArg& arg) {
+    if (arg.TypeAsProto()->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) return -1;
+
+    int64_t num_elements = 1;
+    for (int i = 0; i < shape.dim_size(); ++i) {
+      if (!utils::HasDimValue(shape.dim(i))) return -1;
+      num_elements *= shape.dim(i).dim_value();
+    }
+
+    return num_elements * static_cast<int64_t>(GetElementSize(arg.Type()));
+  }
+
   bool SameSize(const onnxruntime::NodeArg& arg1, const onnxruntime::NodeArg& arg2) {
     if ((!arg1.Exists()) || (!arg2.Exists())) return false;
     auto p_shape1 = context_.GetShape(arg1);
@@ -477,6 +492,15 @@ class PlannerImpl {
     auto& required_memory_info = AllocPlan(output_arg.Name()).location;
     if (HasFence(&output_arg)) return false;
 
+    // Exact shape/type-size matches keep the historical behavior and also work for
+    // symbolic dimensions. When no exact match exists, fall back to best-fit over
+    // statically known byte sizes: a free buffer at least as large as the request
+    // can be aliased directly, which lets e.g. decoders that ping-pong between two
+    // activation shapes share one slab instead of keeping both resident.
+    auto best_fit = freelist_.end();
+    int64_t best_fit_bytes = std::numeric_limits<int64_t>::max();
+    const int64_t required_bytes = StaticSizeInBytes(*p_required_buffer_shape, output_arg);
+
     for (auto it = freelist_.begin(); it != freelist_.end(); ++it) {
       size_t reusable = static_cast<size_t>(it->ml_value);
       const onnxruntime::NodeArg* p_node_arg = ort_value_info_.at(reusable).p_def_site;
@@ -504,8 +528,23 @@ class PlannerImpl {
           freelist_.erase(it);
           return true;
         }
+
+        if (required_bytes > 0) {
+          const int64_t available_bytes = StaticSizeInBytes(*p_available_buffer_shape, *p_node_arg);
+          if (available_bytes >= required_bytes && available_bytes < best_fit_bytes) {
+            best_fit = it;
+            best_fit_bytes = available_bytes;
+          }
+        }
       }
     }
+
+    if (best_fit != freelist_.end()) {
+      *reusable_tensor = best_fit->ml_value;
+      freelist_.erase(best_fit);
+      return true;
+    }
+
     return false;
   }
 
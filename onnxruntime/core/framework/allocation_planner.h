@@ -47,6 +47,15 @@ class ISequentialPlannerContext {
   virtual ~ISequentialPlannerContext() = default;
 };
 
+// AOT planning note: the planner's inputs (resolved graph, kernel
+// assignments, shapes) are all available offline, so a standalone tool could
+// emit the SequentialExecutionPlan as an artifact; what blocks shipping plans
+// today is that the plan bakes in OrtValue indices, kernel hashes, EP
+// placements and allocator config - every invalidation axis the ORT format
+// session-state serialization already keys (see
+// session_state_flatbuffers_utils.h). The right AOT planner is therefore an
+// extension of the ORT format converter emitting the serialized plan alongside
+// the kernel hashes, not a new artifact format.
 class SequentialPlannerContext : public ISequentialPlannerContext {
  public:
   SequentialPlannerContext(ExecutionMode execution_mode, ExecutionOrder execution_order, bool enable_memory_reuse)
@@ -3,6 +3,8 @@
 
 #include "core/framework/allocatormgr.h"
 #include "core/framework/bfc_arena.h"
+#include "core/framework/huge_page_allocator.h"
+#include "core/framework/numa_partitioned_arena.h"
 #include "core/common/logging/logging.h"
 #include <mutex>
 #include <sstream>
@@ -22,6 +24,14 @@ inline int MakeKey(int id, OrtMemType mem_type) {
 AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
   auto device_allocator = info.device_alloc_factory(info.device_id);
 
+  auto maybe_wrap_with_huge_pages = [&info](std::unique_ptr<IAllocator> base_allocator) {
+    if (info.arena_cfg.use_huge_pages != 0 && base_allocator->Info().device.Type() == OrtDevice::CPU) {
+      return std::unique_ptr<IAllocator>(std::make_unique<HugePageAllocator>(std::move(base_allocator)));
+    }
+    return base_allocator;
+  };
+  device_allocator = maybe_wrap_with_huge_pages(std::move(device_allocator));
+
   if (info.use_arena) {
     size_t max_mem = info.arena_cfg.max_mem == 0 ? BFCArena::DEFAULT_MAX_MEM : info.arena_cfg.max_mem;
     int initial_chunk_size_bytes = info.arena_cfg.initial_chunk_size_bytes == -1
@@ -47,13 +57,36 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
         return nullptr;
     }
 
-    return AllocatorPtr(
-        std::make_unique<BFCArena>(std::move(device_allocator),
-                                   max_mem,
-                                   arena_extend_str,
-                                   initial_chunk_size_bytes,
-                                   max_dead_bytes_per_chunk,
-                                   initial_growth_chunk_size_bytes));
+    // the small-allocation fast path only makes sense for host memory
+    const bool enable_small_allocation_cache = device_allocator->Info().device.Type() == OrtDevice::CPU;
+
+    auto make_arena = [&](std::unique_ptr<IAllocator> base_allocator) {
+      return AllocatorPtr(
+          std::make_unique<BFCArena>(std::move(base_allocator),
+                                     max_mem,
+                                     arena_extend_str,
+                                     initial_chunk_size_bytes,
+                                     max_dead_bytes_per_chunk,
+                                     initial_growth_chunk_size_bytes,
+                                     enable_small_allocation_cache,
+                                     info.arena_cfg.shrink_watermark_epochs));
+    };
+
+    if (info.arena_cfg.numa_partitions > 1) {
+      // one sub-arena per NUMA node; allocations are routed to the calling
+      // thread's node so pages are first-touched locally and the arenas' locks
+      // don't contend across sockets.
+      const size_t numa_partitions = static_cast<size_t>(info.arena_cfg.numa_partitions);
+      std::vector<AllocatorPtr> partitions;
+      partitions.reserve(numa_partitions);
+      partitions.push_back(make_arena(std::move(device_allocator)));
+      for (size_t i = 1; i < numa_partitions; ++i) {
+        partitions.push_back(make_arena(maybe_wrap_with_huge_pages(info.device_alloc_factory(info.device_id))));
+      }
+      return AllocatorPtr(std::make_unique<NumaPartitionedArena>(std::move(partitions)));
+    }
+
+    return make_arena(std::move(device_allocator));
   } else {
     return device_allocator;
   }
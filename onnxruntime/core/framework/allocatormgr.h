@@ -32,6 +32,7 @@ struct AllocatorCreationInfo {
   AllocatorFactory device_alloc_factory;
   OrtDevice::DeviceId device_id;
   bool use_arena;
+  // Carries the NUMA partitioning and huge-page knobs as well; see OrtArenaCfg.
   OrtArenaCfg arena_cfg;
 };
 
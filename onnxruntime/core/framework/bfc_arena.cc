@@ -3,6 +3,7 @@
 
 #include "core/framework/allocator.h"
 #include "core/framework/bfc_arena.h"
+#include <map>
 #include <type_traits>
 
 namespace onnxruntime {
@@ -11,12 +12,23 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
                    ArenaExtendStrategy arena_extend_strategy,
                    int initial_chunk_size_bytes,
                    int max_dead_bytes_per_chunk,
-                   int initial_growth_chunk_size_bytes)
+                   int initial_growth_chunk_size_bytes,
+                   bool enable_small_allocation_cache,
+                   int shrink_watermark_epochs)
     : IAllocator(OrtMemoryInfo(resource_allocator->Info().name,
                                OrtAllocatorType::OrtArenaAllocator,
                                resource_allocator->Info().device,
                                resource_allocator->Info().id,
                                resource_allocator->Info().mem_type)),
+      small_alloc_cache_enabled_(enable_small_allocation_cache),
+      // Automatic shrinking frees regions from inside an arbitrary Free call, which
+      // is only safe for host memory: on devices, async work referencing logically
+      // freed chunks may still be enqueued (the same reason the run-option shrink
+      // key only acts at Run end), so the watermark policy is restricted to CPU
+      // arenas regardless of the configured value.
+      shrink_watermark_epochs_(resource_allocator->Info().device.Type() == OrtDevice::CPU
+                                   ? shrink_watermark_epochs
+                                   : -1),
       device_allocator_(std::move(resource_allocator)),
       free_chunks_list_(kInvalidChunkHandle),
       next_allocation_id_(1),
@@ -254,7 +266,86 @@ size_t BFCArena::RoundedBytes(size_t bytes) {
   return rounded_bytes;
 }
 
+namespace {
+// thread-local allocation attribution set by ScopedAllocationTag
+thread_local const char* g_alloc_tag_op_type = nullptr;
+thread_local int64_t g_alloc_tag_node_index = -1;
+}  // namespace
+
+BFCArena::ScopedAllocationTag::ScopedAllocationTag(const char* op_type, int64_t node_index)
+    : previous_op_type_(g_alloc_tag_op_type), previous_node_index_(g_alloc_tag_node_index) {
+  g_alloc_tag_op_type = op_type;
+  g_alloc_tag_node_index = node_index;
+}
+
+BFCArena::ScopedAllocationTag::~ScopedAllocationTag() {
+  // restore the enclosing scope's tag so a control-flow kernel's allocations made
+  // after a subgraph returns keep their attribution
+  g_alloc_tag_op_type = previous_op_type_;
+  g_alloc_tag_node_index = previous_node_index_;
+}
+
+std::string BFCArena::DumpLiveAllocationReport(size_t top_n) {
+  std::lock_guard<OrtMutex> lock(lock_);
+
+  std::map<std::string, size_t> bytes_by_op_type;
+  std::vector<const Chunk*> live_chunks;
+
+  for (const auto& region : region_manager_.regions()) {
+    ChunkHandle h = region_manager_.get_handle(region.ptr());
+    while (h != kInvalidChunkHandle) {
+      const Chunk* c = ChunkFromHandle(h);
+      if (c->in_use()) {
+        bytes_by_op_type[c->tag_op_type != nullptr ? c->tag_op_type : "<untagged>"] += c->size;
+        live_chunks.push_back(c);
+      }
+      h = c->next;
+    }
+  }
+
+  std::sort(live_chunks.begin(), live_chunks.end(),
+            [](const Chunk* a, const Chunk* b) { return a->size > b->size; });
+
+  std::ostringstream ss;
+  ss << "Live allocation report for " << Info().name << "\nBytes in use by op type:\n";
+  for (const auto& entry : bytes_by_op_type) {
+    ss << "  " << entry.first << ": " << entry.second << "\n";
+  }
+
+  ss << "Top " << top_n << " live chunks:\n";
+  for (size_t i = 0; i < live_chunks.size() && i < top_n; ++i) {
+    const Chunk* c = live_chunks[i];
+    ss << "  size: " << c->size << " op_type: " << (c->tag_op_type != nullptr ? c->tag_op_type : "<untagged>")
+       << " node_index: " << c->tag_node_index << "\n";
+  }
+
+  return ss.str();
+}
+
 void* BFCArena::Alloc(size_t size) {
+  if (small_alloc_cache_enabled_ && size > 0 && size <= kSmallAllocMaxBytes) {
+    const size_t size_class = SmallSizeClassOf(size);
+    {
+      SmallSizeClassCache& cache = small_caches_[size_class];
+      std::lock_guard<OrtMutex> lock(cache.lock);
+      if (!cache.free_list.empty()) {
+        void* p = cache.free_list.back();
+        cache.free_list.pop_back();
+        return p;
+      }
+    }
+
+    // miss: carve the full size class from the arena so the block can serve any
+    // request of this class once it comes back through Free
+    void* p = AllocateRawInternal((size_class + 1) * kSmallSizeClassBytes, false);
+    if (p != nullptr) {
+      SmallPtrMapShard& shard = SmallShardFor(p);
+      std::lock_guard<OrtMutex> lock(shard.lock);
+      shard.size_class_of[p] = size_class;
+    }
+    return p;
+  }
+
   return AllocateRawInternal(size, false);
 }
 
@@ -379,6 +470,8 @@ void* BFCArena::FindChunkPtr(BinNum bin_num, size_t rounded_bytes,
         // Assign a unique id and increment the id counter, marking the
         // chunk as being in use.
         chunk->allocation_id = next_allocation_id_++;
+        chunk->tag_op_type = g_alloc_tag_op_type;
+        chunk->tag_node_index = g_alloc_tag_node_index;
         // Update stats.
         ++stats_.num_allocs;
         stats_.bytes_in_use += chunk->size;
@@ -432,6 +525,26 @@ void BFCArena::Free(void* p) {
   if (p == nullptr) {
     return;
   }
+
+  // small blocks go back to their size-class cache unless it is full
+  if (small_alloc_cache_enabled_) {
+    SmallPtrMapShard& shard = SmallShardFor(p);
+    std::lock_guard<OrtMutex> shard_lock(shard.lock);
+    auto small_it = shard.size_class_of.find(p);
+    if (small_it != shard.size_class_of.end()) {
+      SmallSizeClassCache& cache = small_caches_[small_it->second];
+      {
+        std::lock_guard<OrtMutex> cache_lock(cache.lock);
+        if (cache.free_list.size() < kSmallCacheCapacityPerClass) {
+          cache.free_list.push_back(p);
+          return;
+        }
+      }
+      // cache full: release the block to the arena for real
+      shard.size_class_of.erase(small_it);
+    }
+  }
+
   std::lock_guard<OrtMutex> lock(lock_);
   auto it = reserved_chunks_.find(p);
   if (it != reserved_chunks_.end()) {
@@ -442,10 +555,19 @@ void BFCArena::Free(void* p) {
   } else {
     DeallocateRawInternal(p);
   }
+
+  if (shrink_watermark_epochs_ > 0) {
+    MaybeAutoShrink();
+  }
 }
 
 Status BFCArena::Shrink() {
   std::lock_guard<OrtMutex> lock(lock_);
+  ShrinkImpl();
+  return Status::OK();
+}
+
+void BFCArena::ShrinkImpl() {
   auto num_regions = region_manager_.regions().size();
   std::vector<void*> region_ptrs;
   std::vector<size_t> region_sizes;
@@ -504,8 +626,29 @@ Status BFCArena::Shrink() {
   // Will affect how the arena grows if the arena extend strategy is kNextPowerOfTwo
   // In case the extend strategy is kSameAsRequested, the arena growth is exactly the size of the memory request itself
   curr_region_allocation_bytes_ = initial_growth_chunk_size_bytes_;
+}
 
-  return Status::OK();
+void BFCArena::MaybeAutoShrink() {
+  epoch_high_watermark_ = std::max(epoch_high_watermark_, stats_.bytes_in_use);
+
+  if (++frees_in_epoch_ < kShrinkEpochFrees) {
+    return;
+  }
+  frees_in_epoch_ = 0;
+
+  // fold this epoch's peak into the decaying watermark so a single worst-case
+  // request stops pinning the arena at its historical peak forever
+  decayed_watermark_ = std::max(epoch_high_watermark_, decayed_watermark_ - decayed_watermark_ / 4);
+  epoch_high_watermark_ = stats_.bytes_in_use;
+
+  if (decayed_watermark_ < stats_.total_allocated_bytes / 2) {
+    if (++epochs_below_watermark_ >= shrink_watermark_epochs_) {
+      epochs_below_watermark_ = 0;
+      ShrinkImpl();
+    }
+  } else {
+    epochs_below_watermark_ = 0;
+  }
 }
 
 void BFCArena::DeallocateRawInternal(void* ptr) {
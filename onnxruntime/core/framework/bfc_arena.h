@@ -19,6 +19,7 @@ limitations under the License.
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 #include "onnxruntime_config.h"
 
@@ -58,12 +59,19 @@ class BFCArena : public IAllocator {
   static const int DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES = 2 * 1024 * 1024;
   static const size_t DEFAULT_MAX_MEM = std::numeric_limits<size_t>::max();
 
+  // 'enable_small_allocation_cache' turns on the per-size-class fast path for
+  // small allocations; see the cache members below for the semantics. It keeps
+  // up to ~4MB of small blocks out of the bins (they count as in-use in the
+  // stats), so it is off by default and enabled by CreateAllocator for CPU
+  // arenas.
   BFCArena(std::unique_ptr<IAllocator> resource_allocator,
            size_t total_memory,
            ArenaExtendStrategy arena_extend_strategy = DEFAULT_ARENA_EXTEND_STRATEGY,
            int initial_chunk_size_bytes = DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
            int max_dead_bytes_per_chunk = DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
-           int initial_growth_chunk_size_bytes = DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES);
+           int initial_growth_chunk_size_bytes = DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+           bool enable_small_allocation_cache = false,
+           int shrink_watermark_epochs = -1);
 
   ~BFCArena() override;
 
@@ -83,6 +91,13 @@ class BFCArena : public IAllocator {
   // and the allocation request.
   Status Shrink();
 
+  // Reserve here means "allocate outside the arena's chunk pools"
+  // (freed directly back to the device allocator, never pooled) - it is not a
+  // virtual-address reserve/commit split. A true split (reserve VA, commit
+  // pages on demand, decommit on Shrink) needs device allocator support
+  // (mmap/PROT_NONE + mprotect on CPU, cuMemAddressReserve/cuMemMap on CUDA)
+  // behind a new IAllocator capability; the arena itself would only need
+  // Extend/Shrink to call commit/decommit instead of alloc/free.
   void* Reserve(size_t size) override;
 
   FencePtr CreateFence(const SessionState* session_state) override {
@@ -92,6 +107,29 @@ class BFCArena : public IAllocator {
 
   void GetStats(AllocatorStats* stats) override;
 
+  // Tags every allocation made on this thread with the executing node while in
+  // scope, so the live-allocation report can attribute arena bytes to op types.
+  // Nests: a control-flow kernel executing a subgraph mid-Compute gets its own
+  // tag restored when the inner scope ends.
+  class ScopedAllocationTag {
+   public:
+    ScopedAllocationTag(const char* op_type, int64_t node_index);
+    ~ScopedAllocationTag();
+
+   private:
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScopedAllocationTag);
+
+    const char* previous_op_type_;
+    int64_t previous_node_index_;
+  };
+
+  // Report of live (in-use) chunks: bytes aggregated by tagged op type plus the
+  // top-N largest live chunks with their producing node index. Intended for
+  // logging when a host approaches its memory limit. Note: blocks parked in the
+  // small-allocation cache still count as live here (bounded at ~4MB) and keep
+  // the tag of their last user.
+  std::string DumpLiveAllocationReport(size_t top_n = 10);
+
   size_t RequestedSize(const void* ptr);
 
   size_t AllocatedSize(const void* ptr);
@@ -100,6 +138,58 @@ class BFCArena : public IAllocator {
   void* AllocateRawInternal(size_t num_bytes, bool dump_log_on_failure);
   void DeallocateRawInternal(void* ptr);
 
+  // Fast-path cache for small allocations. The flood of small (<= 4KB) temporary
+  // tensors otherwise serializes on lock_; instead those requests are rounded up
+  // to a 256-byte size class and served from per-class free lists, with ownership
+  // tracked in a pointer map sharded by pointer hash so Free can route cached
+  // blocks back without taking lock_. Cached blocks stay "in use" from the main
+  // bins' perspective, bounding the cache to ~4MB of resident overhead.
+  static constexpr size_t kSmallSizeClassBytes = 256;
+  static constexpr size_t kSmallAllocMaxBytes = 4096;
+  static constexpr size_t kNumSmallSizeClasses = kSmallAllocMaxBytes / kSmallSizeClassBytes;
+  static constexpr size_t kSmallCacheCapacityPerClass = 64;
+  static constexpr size_t kSmallPtrMapShards = 64;
+
+  struct SmallSizeClassCache {
+    OrtMutex lock;
+    std::vector<void*> free_list;
+  };
+
+  struct SmallPtrMapShard {
+    OrtMutex lock;
+    std::unordered_map<const void*, size_t> size_class_of;
+  };
+
+  static size_t SmallSizeClassOf(size_t size) { return (size - 1) / kSmallSizeClassBytes; }
+
+  SmallPtrMapShard& SmallShardFor(const void* p) {
+    return small_ptr_map_shards_[std::hash<const void*>{}(p) % kSmallPtrMapShards];
+  }
+
+  std::array<SmallSizeClassCache, kNumSmallSizeClasses> small_caches_;
+  std::array<SmallPtrMapShard, kSmallPtrMapShards> small_ptr_map_shards_;
+  const bool small_alloc_cache_enabled_;
+
+  // Watermark-driven automatic shrinking (see OrtArenaCfg::shrink_watermark_epochs).
+  // Every kShrinkEpochFrees frees ends an epoch: the per-epoch high watermark of
+  // bytes in use is folded into a decaying watermark, and once that watermark has
+  // stayed below half of the reserved bytes for shrink_watermark_epochs_ epochs in
+  // a row, fully free regions are returned to the OS. All fields below are guarded
+  // by lock_.
+  static constexpr size_t kShrinkEpochFrees = 1024;
+
+  // frees regions that contain no in-use chunk. lock_ must be held by the caller.
+  void ShrinkImpl();
+
+  // epoch bookkeeping for the automatic shrink policy. lock_ must be held.
+  void MaybeAutoShrink();
+
+  const int shrink_watermark_epochs_;
+  size_t frees_in_epoch_ = 0;
+  int64_t epoch_high_watermark_ = 0;
+  int64_t decayed_watermark_ = 0;
+  int epochs_below_watermark_ = 0;
+
   // A ChunkHandle is an index into the chunks_ vector in BFCAllocator
   // kInvalidChunkHandle means an invalid chunk
   using ChunkHandle = size_t;
@@ -143,6 +233,11 @@ class BFCArena : public IAllocator {
     // What bin are we in?
     BinNum bin_num = kInvalidBinNum;
 
+    // attribution of the allocation to the node that made it (see
+    // ScopedAllocationTag); null/-1 for allocations made outside kernel execution
+    const char* tag_op_type = nullptr;
+    int64_t tag_node_index = -1;
+
     bool in_use() const { return allocation_id != -1; }
 
     std::string DebugString(BFCArena* a, bool recurse) {
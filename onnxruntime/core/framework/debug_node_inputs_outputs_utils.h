@@ -14,6 +14,13 @@
 
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS
 
+// Replay workflow note: per-node replay for kernel regression
+// hunting composes from what's here plus OpTester - build with
+// DEBUG_NODE_INPUTS_OUTPUTS, dump a node's inputs via the environment-variable
+// filters below, and feed the captured tensors to an OpTester case for the
+// suspect op so it runs standalone under both the old and new kernels. A
+// first-class harness would automate exactly that capture -> OpTester bridge;
+// the dump format already carries everything needed (names, shapes, values).
 #pragma once
 
 #include "core/common/path.h"
@@ -27,8 +27,10 @@ namespace onnxruntime {
 
 IExecutionFrame::IExecutionFrame(const OrtValueNameIdxMap& ort_value_idx_map,
                                  const NodeIndexInfo& node_index_info,
-                                 const std::vector<int>& fetch_mlvalue_idxs)
+                                 const std::vector<int>& fetch_mlvalue_idxs,
+                                 std::vector<OrtValue>&& all_values_buffer)
     : node_index_info_(node_index_info),
+      all_values_(std::move(all_values_buffer)),
       all_values_size_(static_cast<size_t>(ort_value_idx_map.MaxIdx()) + 1),
       fetch_mlvalue_idxs_(fetch_mlvalue_idxs),
       ort_value_idx_map_(ort_value_idx_map) {
@@ -38,7 +40,6 @@ IExecutionFrame::IExecutionFrame(const OrtValueNameIdxMap& ort_value_idx_map,
 
 IExecutionFrame::~IExecutionFrame() = default;
 
-#ifdef ENABLE_TRAINING
 Status IExecutionFrame::SetOutputMLValue(int index, const OrtValue& ort_value) {
   int ort_value_idx = GetNodeIdxToMLValueIdx(index);
   if (ort_value_idx == NodeIndexInfo::kInvalidEntry || static_cast<size_t>(ort_value_idx) >= all_values_size_) {
@@ -118,7 +119,48 @@ Status IExecutionFrame::GetOutputs(const std::vector<int>& fetch_mlvalue_idxs, s
   return Status::OK();
 }
 
-#endif
+void* IExecutionFrame::AllocateScratchBuffer(size_t nbytes) {
+  if (nbytes == 0) {
+    return nullptr;
+  }
+
+  static constexpr size_t kScratchAlignment = 64;
+
+  std::lock_guard<OrtMutex> lock(scratch_lock_);
+
+  if (scratch_slab_ == nullptr) {
+    scratch_capacity_ = InitialScratchCapacityHint();
+    if (scratch_capacity_ > 0) {
+      scratch_slab_ = std::make_unique<char[]>(scratch_capacity_);
+    }
+  }
+
+  // bump-allocate from the slab at 64-byte alignment
+  if (scratch_slab_ != nullptr) {
+    const uintptr_t base = reinterpret_cast<uintptr_t>(scratch_slab_.get());
+    const uintptr_t aligned = (base + scratch_top_ + kScratchAlignment - 1) & ~uintptr_t{kScratchAlignment - 1};
+    const size_t new_top = static_cast<size_t>(aligned - base) + nbytes;
+    if (new_top <= scratch_capacity_) {
+      scratch_top_ = new_top;
+      scratch_peak_bytes_ = std::max(scratch_peak_bytes_, scratch_top_ + scratch_overflow_bytes_);
+      return reinterpret_cast<void*>(aligned);
+    }
+  }
+
+  // overflow: plain heap allocation, released together with the slab allocations
+  scratch_overflow_.push_back(std::make_unique<char[]>(nbytes + kScratchAlignment));
+  scratch_overflow_bytes_ += nbytes + kScratchAlignment;
+  scratch_peak_bytes_ = std::max(scratch_peak_bytes_, scratch_top_ + scratch_overflow_bytes_);
+  const uintptr_t raw = reinterpret_cast<uintptr_t>(scratch_overflow_.back().get());
+  return reinterpret_cast<void*>((raw + kScratchAlignment - 1) & ~uintptr_t{kScratchAlignment - 1});
+}
+
+void IExecutionFrame::ReleaseScratchBuffers() {
+  std::lock_guard<OrtMutex> lock(scratch_lock_);
+  scratch_top_ = 0;
+  scratch_overflow_bytes_ = 0;
+  scratch_overflow_.clear();
+}
 
 // Return nullptr if index map to an value that is an unused optional input/output
 const OrtValue* IExecutionFrame::GetNodeInputOrOutputMLValue(int index) const {
@@ -330,7 +372,8 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
                                const std::vector<int>& fetch_mlvalue_idxs, const std::vector<OrtValue>& fetches,
                                const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
                                const SessionState& session_state)
-    : IExecutionFrame(session_state.GetOrtValueNameIdxMap(), session_state.GetNodeIndexInfo(), fetch_mlvalue_idxs),
+    : IExecutionFrame(session_state.GetOrtValueNameIdxMap(), session_state.GetNodeIndexInfo(), fetch_mlvalue_idxs,
+                      session_state.RentOrtValueBuffer()),
       session_state_(session_state),
       mem_patterns_(nullptr),
       planner_(nullptr) {
@@ -450,7 +493,17 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
   }
 }
 
-ExecutionFrame::~ExecutionFrame() = default;
+ExecutionFrame::~ExecutionFrame() {
+  // let the next run size its scratch slab to cover this run's peak
+  session_state_.UpdateScratchCapacityHint(ScratchPeakBytes());
+
+  // recycle the OrtValue storage so the next Run reuses its capacity
+  session_state_.ReturnOrtValueBuffer(DetachOrtValueBuffer());
+}
+
+size_t ExecutionFrame::InitialScratchCapacityHint() const {
+  return session_state_.GetScratchCapacityHint();
+}
 
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
@@ -7,6 +7,8 @@
 #include <vector>
 #include <unordered_map>
 
+#include "core/platform/ort_mutex.h"
+
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
 #include "core/common/status.h"
@@ -30,9 +32,13 @@ class IExecutionFrame {
  protected:
   // Derived class must call Init in its ctor. We need to use some of the virtual methods in Init and those aren't
   // initialized until the derived class is constructed.
+  // 'all_values_buffer' optionally provides recycled backing storage for the OrtValue
+  // vector (see SessionState::RentOrtValueBuffer); its capacity is reused so a
+  // steady-state Run doesn't re-allocate the largest per-Run vector.
   IExecutionFrame(const OrtValueNameIdxMap& ort_value_idx_map,
                   const NodeIndexInfo& node_index_info,
-                  const std::vector<int>& fetch_mlvalue_idxs);
+                  const std::vector<int>& fetch_mlvalue_idxs,
+                  std::vector<OrtValue>&& all_values_buffer = std::vector<OrtValue>{});
 
   void Init(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
             const std::unordered_map<int, OrtValue>& initializers,
@@ -51,14 +57,12 @@ class IExecutionFrame {
   const OrtValue* GetNodeInputOrOutputMLValue(int index) const;
   OrtValue* GetMutableNodeInputOrOutputMLValue(int index);
 
-#ifdef ENABLE_TRAINING
   // Override the index-th output with ort_value
   Status SetOutputMLValue(int index, const OrtValue& ort_value);
   void UpdateFeeds(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds);
   void UpdateFetches(const std::vector<int>& fetch_mlvalue_idxs, const std::vector<OrtValue>& fetches,
                      const std::unordered_map<int, OrtValue>& initializers);
   Status GetOutputs(const std::vector<int>& fetch_mlvalue_idxs, std::vector<OrtValue>& fetches);
-#endif
 
   // TO DO: make it thread safe
   // This method is not thread safe!
@@ -81,6 +85,19 @@ class IExecutionFrame {
 
   Status ReleaseMLValue(int ort_value_idx);
 
+  /**
+   * Scratch memory for kernel temporaries, backing OpKernelContext::GetScratchBuffer.
+   * Allocations are pointer bumps from a per-run slab (sized by the capacity hint the
+   * derived frame provides), with heap overflow for requests that don't fit. Buffers
+   * stay valid until ReleaseScratchBuffers, which executors call once the node that
+   * made the allocations has completed; under parallel execution release is deferred
+   * to frame destruction.
+   */
+  void* AllocateScratchBuffer(size_t nbytes);
+
+  /** Releases all scratch buffers handed out since the last release. */
+  void ReleaseScratchBuffers();
+
  protected:
   // get the ort_value_idx from NodeIndexInfo
   int GetNodeIdxToMLValueIdx(int index) const;
@@ -92,6 +109,20 @@ class IExecutionFrame {
   // returns true if the ort_value_idx is an output from the graph
   bool IsOutput(int ort_value_idx) const;
 
+  // size to reserve for the scratch slab up front. derived frames can remember the
+  // peak of earlier runs so the steady state never overflows to the heap.
+  virtual size_t InitialScratchCapacityHint() const { return 0; }
+
+  // high watermark of scratch bytes live at any point during this run
+  size_t ScratchPeakBytes() const { return scratch_peak_bytes_; }
+
+  // releases all OrtValues and hands back the underlying buffer so its capacity can
+  // be recycled by the next frame. The frame must not be used afterwards.
+  std::vector<OrtValue> DetachOrtValueBuffer() {
+    all_values_.clear();
+    return std::move(all_values_);
+  }
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IExecutionFrame);
 
@@ -124,6 +155,15 @@ class IExecutionFrame {
   std::vector<int> fetch_mlvalue_idxs_;
 
   const OrtValueNameIdxMap& ort_value_idx_map_;
+
+  // scratch buffer state; guarded by scratch_lock_ as nodes may run concurrently
+  OrtMutex scratch_lock_;
+  std::unique_ptr<char[]> scratch_slab_;
+  size_t scratch_capacity_ = 0;
+  size_t scratch_top_ = 0;
+  size_t scratch_overflow_bytes_ = 0;
+  size_t scratch_peak_bytes_ = 0;
+  std::vector<std::unique_ptr<char[]>> scratch_overflow_;
 };
 
 class ExecutionFrame final : public IExecutionFrame {
@@ -158,6 +198,9 @@ class ExecutionFrame final : public IExecutionFrame {
   // If the retrival is sucessful, this function returns true and false otherwise.
   bool TryGetInferredShape(int index, TensorShape& shape) const override;
 
+  // remembers the peak scratch usage of earlier runs via the session state
+  size_t InitialScratchCapacityHint() const override;
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Return the size of virtual memory allocated in runtime.
   // The memory is usually used for activations in forward and backward passes.
@@ -214,7 +257,7 @@ class ExecutionFrame final : public IExecutionFrame {
   // If we already have cached memory pattern on these input shapes
   // Use this mem pattern that create a big chunk for all the internal
   // kernel's input/output tensors.
-  const MemoryPatternGroup* mem_patterns_;
+  std::shared_ptr<const MemoryPatternGroup> mem_patterns_;
 
   // If no cached memory pattern, and we enable the memory pattern optimization
   // use this planner_ to trace the memory allocation in current executor.
@@ -1,6 +1,12 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// Shape-subgraph placement: shape-manipulation chains are forced onto CPU by
+// this fallback analysis so Shape/Gather/Concat-on-shapes never execute on
+// device. A GPU->CPU sync therefore only arises when a tensor's shape values
+// are data dependent (e.g. NonZero feeding Reshape); computing those on device
+// would leave downstream shapes unknown at enqueue time and needs deferred
+// allocation support in the planner, not device shape kernels.
 #pragma once
 
 #include "core/common/inlined_containers_fwd.h"
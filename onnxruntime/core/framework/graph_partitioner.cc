@@ -610,6 +610,10 @@ Status GraphPartitioner::PartitionOrtFormatModel(
   return Status::OK();
 }
 
+// Performance note: each registered EP re-walks the graph in GetCapability, so
+// init cost scales with provider count. The ORT format flow already persists
+// the partitioning outcome (kernel-hash resolved nodes), which is the supported
+// way to pay this once offline.
 Status GraphPartitioner::Partition(Graph& graph, bool export_dll, FuncManager& func_mgr, 
                                    TransformLayoutFunction transform_layout_function, Mode mode,
                                    std::unordered_map<std::string, HashValue>* compiled_kernel_hashes) const {
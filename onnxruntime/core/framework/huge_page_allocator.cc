@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/huge_page_allocator.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace onnxruntime {
+
+HugePageAllocator::~HugePageAllocator() {
+#ifdef __linux__
+  // release any mappings the owner didn't free explicitly
+  for (const auto& entry : mapped_regions_) {
+    munmap(entry.first, entry.second);
+  }
+#endif
+}
+
+void* HugePageAllocator::TryAllocHugePages(size_t size, size_t& mapped_size) {
+#ifdef __linux__
+  static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+  mapped_size = (size + kHugePageSize - 1) & ~(kHugePageSize - 1);
+
+  void* p = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (p != MAP_FAILED) {
+    return p;
+  }
+
+  // no explicit huge pages reserved; fall back to a normal mapping and ask the
+  // kernel to promote it to transparent huge pages
+  p = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED) {
+    return nullptr;
+  }
+
+#ifdef MADV_HUGEPAGE
+  // best effort; the mapping is usable either way
+  (void)madvise(p, mapped_size, MADV_HUGEPAGE);
+#endif
+  return p;
+#else
+  // explicit large pages need privilege management on other platforms; use the
+  // base allocator there
+  ORT_UNUSED_PARAMETER(size);
+  mapped_size = 0;
+  return nullptr;
+#endif
+}
+
+void* HugePageAllocator::Alloc(size_t size) {
+  if (size >= threshold_bytes_) {
+    size_t mapped_size = 0;
+    void* p = TryAllocHugePages(size, mapped_size);
+    if (p != nullptr) {
+      std::lock_guard<OrtMutex> lock(mapped_regions_lock_);
+      mapped_regions_[p] = mapped_size;
+      return p;
+    }
+  }
+
+  return base_allocator_->Alloc(size);
+}
+
+void HugePageAllocator::Free(void* p) {
+  if (p == nullptr) return;
+
+  {
+    std::lock_guard<OrtMutex> lock(mapped_regions_lock_);
+    auto it = mapped_regions_.find(p);
+    if (it != mapped_regions_.end()) {
+#ifdef __linux__
+      munmap(p, it->second);
+#endif
+      mapped_regions_.erase(it);
+      return;
+    }
+  }
+
+  base_allocator_->Free(p);
+}
+
+}  // namespace onnxruntime
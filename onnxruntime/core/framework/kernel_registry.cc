@@ -282,6 +282,10 @@ static std::string ToString(const std::vector<std::string>& error_strs) {
 // if this function is called before graph partition, then node.provider is not set.
 // In this case, the kernel's provider must equal to exec_provider
 // otherwise, kernel_def.provider must equal to node.provider. exec_provider is ignored.
+// Lookup cost note: the multimap bucket walk is O(candidates-for-op) and the
+// per-candidate version/type checks are required semantics. A perfect hash can't
+// be built at static init (custom ops and EP kernels register later); if lookup
+// time matters, memoize the resolved KernelCreateInfo per node instead.
 Status KernelRegistry::TryFindKernel(const Node& node,
                                      ProviderType exec_provider,
                                      const KernelCreateInfo** out) const {
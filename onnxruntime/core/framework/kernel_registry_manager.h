@@ -25,6 +25,14 @@ class SessionState;
 // The 1st and 2nd ones are shared across sessions.
 
 // This class is not thread safe.
+// Call-overhead note: in-process execution providers bind kernels
+// directly (virtual Compute through the OpKernel vtable - one indirect call);
+// the provider-bridge indirection exists only for the separately compiled
+// shared EPs, where provider_bridge_ort routes API calls through a function
+// table by design so the shared library stays ABI-stable across builds.
+// Collapsing that table into direct vtable binding would re-couple the shared
+// EP to the exact core build, which the bridge exists to prevent; the per-call
+// cost is one table hop and is invisible next to kernel work.
 class KernelRegistryManager {
  public:
   KernelRegistryManager() = default;
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/numa_partitioned_arena.h"
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <Windows.h>
+#endif
+
+namespace onnxruntime {
+
+static const OrtMemoryInfo& FirstPartitionInfo(const std::vector<AllocatorPtr>& partitions) {
+  ORT_ENFORCE(partitions.size() > 1, "NumaPartitionedArena requires at least two partitions.");
+  return partitions[0]->Info();
+}
+
+NumaPartitionedArena::NumaPartitionedArena(std::vector<AllocatorPtr> partitions)
+    : IAllocator(FirstPartitionInfo(partitions)), partitions_(std::move(partitions)) {
+  for (const auto& partition : partitions_) {
+    ORT_ENFORCE(partition->Info() == Info(), "All NUMA arena partitions must share one OrtMemoryInfo.");
+  }
+}
+
+size_t NumaPartitionedArena::CurrentNumaNode() {
+#ifdef __linux__
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return node;
+  }
+  return 0;
+#elif defined(_WIN32)
+  PROCESSOR_NUMBER processor;
+  GetCurrentProcessorNumberEx(&processor);
+  USHORT node = 0;
+  if (GetNumaProcessorNodeEx(&processor, &node)) {
+    return node;
+  }
+  return 0;
+#else
+  return 0;
+#endif
+}
+
+void* NumaPartitionedArena::Alloc(size_t size) {
+  const size_t partition = CurrentNumaNode() % partitions_.size();
+  void* p = partitions_[partition]->Alloc(size);
+  if (p != nullptr) {
+    PtrMapShard& shard = ShardFor(p);
+    std::lock_guard<OrtMutex> lock(shard.lock);
+    shard.partition_of[p] = partition;
+  }
+  return p;
+}
+
+void* NumaPartitionedArena::Reserve(size_t size) {
+  const size_t partition = CurrentNumaNode() % partitions_.size();
+  void* p = partitions_[partition]->Reserve(size);
+  if (p != nullptr) {
+    PtrMapShard& shard = ShardFor(p);
+    std::lock_guard<OrtMutex> lock(shard.lock);
+    shard.partition_of[p] = partition;
+  }
+  return p;
+}
+
+void NumaPartitionedArena::Free(void* p) {
+  if (p == nullptr) return;
+
+  size_t partition;
+  {
+    PtrMapShard& shard = ShardFor(p);
+    std::lock_guard<OrtMutex> lock(shard.lock);
+    auto it = shard.partition_of.find(p);
+    ORT_ENFORCE(it != shard.partition_of.end(), "Pointer was not allocated by this NumaPartitionedArena.");
+    partition = it->second;
+    shard.partition_of.erase(it);
+  }
+
+  partitions_[partition]->Free(p);
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+#include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+/**
+ * NUMA-partitioned arena front-end.
+ *
+ * Owns one sub-arena per NUMA node and routes each allocation to the arena of
+ * the calling thread's node, so arena lock contention splits across nodes and
+ * chunk memory is first-touched (and thus physically placed) on the node that
+ * will use it: BFCArena::Extend allocates through the underlying device
+ * allocator on the requesting thread, which makes the kernel's first-touch
+ * policy place the pages locally.
+ *
+ * Frees are routed back to the owning sub-arena through a pointer-to-partition
+ * map sharded by pointer hash, so a cross-thread Free takes one small shard
+ * lock instead of the global arena mutex.
+ */
+// Placement pinning note: this arena places ACTIVATIONS on the
+// allocating thread's node via first touch. Pinning INITIALIZERS and planned
+// buffers to explicit NUMA/CXL tiers is a different mechanism - the initializer
+// load path and the pattern planner would need a per-tensor node assignment
+// (a session option mapping name patterns to nodes) and an allocator that
+// binds regions with mbind/numa_alloc_onnode. The partition selection hook
+// below (CurrentNumaNode) is where an explicit-node override would plug in.
+class NumaPartitionedArena : public IAllocator {
+ public:
+  // 'partitions' must contain one arena per NUMA node, indexed by node number.
+  // All partitions must report the same OrtMemoryInfo.
+  explicit NumaPartitionedArena(std::vector<AllocatorPtr> partitions);
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+  void* Reserve(size_t size) override;
+
+  // NUMA node of the calling thread, or 0 if the platform can't say.
+  static size_t CurrentNumaNode();
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(NumaPartitionedArena);
+
+  static constexpr size_t kPtrMapShards = 64;
+
+  struct PtrMapShard {
+    OrtMutex lock;
+    std::unordered_map<const void*, size_t> partition_of;
+  };
+
+  PtrMapShard& ShardFor(const void* p) {
+    return ptr_map_shards_[std::hash<const void*>{}(p) % kPtrMapShards];
+  }
+
+  AllocatorPtr& PartitionForThisThread() {
+    return partitions_[CurrentNumaNode() % partitions_.size()];
+  }
+
+  std::vector<AllocatorPtr> partitions_;
+  std::array<PtrMapShard, kPtrMapShards> ptr_map_shards_;
+};
+
+}  // namespace onnxruntime
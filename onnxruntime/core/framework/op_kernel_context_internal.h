@@ -53,11 +53,9 @@ class OpKernelContextInternal : public OpKernelContext {
     return OpKernelContext::GetOutputMLValue(index);
   }
 
-#ifdef ENABLE_TRAINING
   Status SetOutputMLValue(int index, const OrtValue& ort_value) {
     return OpKernelContext::SetOutputMLValue(index, ort_value);
   }
-#endif
 
   OrtValue* OutputMLValue(int index, const TensorShape& shape) {
     return OpKernelContext::OutputMLValue(index, shape);
@@ -21,9 +21,9 @@ namespace onnxruntime {
 ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag)
     : out_standings_(0), terminate_flag_(terminate_flag), executor_pool_(session_state.GetInterOpThreadPool()) {
   const auto& graph_viewer = session_state.GetGraphViewer();
-  node_refs_.resize(graph_viewer.MaxNodeIndex());
+  node_refs_ = std::vector<std::atomic<int>>(graph_viewer.MaxNodeIndex());
   for (auto& node : graph_viewer.Nodes()) {
-    node_refs_[node.Index()] = node.GetInputEdgesCount();
+    node_refs_[node.Index()].store(static_cast<int>(node.GetInputEdgesCount()), std::memory_order_relaxed);
   }
 }
 
@@ -53,7 +53,7 @@ Status ParallelExecutor::Execute(const SessionState& session_state, const std::v
   // Wait for finish.
   {
     std::unique_lock<OrtMutex> lock(complete_mutex_);
-    while (out_standings_ > 0) complete_cv_.wait(lock);
+    while (out_standings_.load(std::memory_order_acquire) > 0) complete_cv_.wait(lock);
   }
 
   Status status = Status::OK();
@@ -256,15 +256,16 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
 
     keep_running = false;
 
-    // Checking which output nodes ready for running.
+    // Check which downstream nodes became ready. The decrement is lock-free; exactly
+    // one producer observes the count reach zero and owns scheduling the consumer.
+    // The first ready consumer is run inline to avoid a context switch.
     {
       auto begin = node.OutputEdgesBegin();
       auto end = node.OutputEdgesEnd();
 
-      std::lock_guard<OrtMutex> lock(ref_mutex_);
       for (auto it = begin; it != end; it++) {
         auto idx = (*it).GetNode().Index();
-        if ((--node_refs_[idx]) == 0) {
+        if (node_refs_[idx].fetch_sub(1, std::memory_order_acq_rel) == 1) {
           if (!keep_running) {
             node_index = idx;
             keep_running = true;
@@ -272,10 +273,6 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
             EnqueueNode(idx, session_state, logger);
           }
         }
-
-        // std::cout << "handle output, current name: " << node.Name() << ", current index: "
-        // << p_node_index << ", output name: " << (*it)->GetNode().Name() << ", output index: "
-        // << (*it)->GetNode().Index() << ", after -- output ref: " << node_refs_[idx] << std::endl;
       }
     }
   }
@@ -284,14 +281,11 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
 }
 
 void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger) {
-  {
-    std::unique_lock<OrtMutex> lock(complete_mutex_);
-    // if there are errors there's no point queuing more work
-    if (!errors_.empty())
-      return;
+  // if there are errors there's no point queuing more work
+  if (have_errors_.load(std::memory_order_acquire))
+    return;
 
-    out_standings_++;
-  }
+  out_standings_.fetch_add(1, std::memory_order_acq_rel);
 
   onnxruntime::concurrency::ThreadPool::Schedule(executor_pool_, [this, p_node_index, &session_state, &logger]() {
     auto create_exception_message = [p_node_index, &session_state](const std::exception* ex) {
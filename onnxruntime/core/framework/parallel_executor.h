@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "core/common/common.h"
 #include "core/common/status.h"
@@ -36,28 +37,30 @@ class ParallelExecutor : public IExecutor {
   void EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger);
 
   void FinishNodeRun(const Status& status) {
-    bool finished = false;
-    {
-      //Because we have a mutex here, it's not possible another thread is doing the test("while (out_standings_ > 0)"
+    if (!status.IsOK()) {
       std::lock_guard<OrtMutex> lock(complete_mutex_);
-      finished = --out_standings_ == 0;
-      if (!status.IsOK())
-        errors_.push_back(status);
+      errors_.push_back(status);
+      have_errors_.store(true, std::memory_order_release);
     }
 
-    if (finished) {
-      //std::cout << "all out standing nodes are completed." << std::endl;
+    if (out_standings_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      // Take the lock so the notify can't race with the waiter's "out_standings_ > 0"
+      // test, then wake it.
+      std::lock_guard<OrtMutex> lock(complete_mutex_);
       complete_cv_.notify_all();
     }
   }
 
   std::unique_ptr<ExecutionFrame> root_frame_;
-  std::vector<size_t> node_refs_;
-  OrtMutex ref_mutex_;
-  int out_standings_;  //protected by complete_mutex_
+  // Remaining unsatisfied input edges per node. Nodes become ready to run when their
+  // count drops to zero; decrements are lock-free so completion of independent
+  // branches doesn't serialize on a mutex.
+  std::vector<std::atomic<int>> node_refs_;
+  std::atomic<int> out_standings_;
   OrtMutex complete_mutex_;
   OrtCondVar complete_cv_;
-  std::vector<Status> errors_;
+  std::vector<Status> errors_;            // protected by complete_mutex_
+  std::atomic<bool> have_errors_{false};  // set when errors_ becomes non-empty
 
   const bool& terminate_flag_;
   // TODO: Temporary threadpool for the executor.  This is a costly way to handle the problem.
@@ -1,7 +1,6 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
-#ifdef ENABLE_TRAINING
-#include "core/framework/orttraining_partial_executor.h"
+#include "core/framework/partial_executor.h"
 
 #include <chrono>
 #include <thread>
@@ -452,6 +451,7 @@ Status PartialExecutor::Execute(const SessionState& session_state, const std::ve
     // free ml-values corresponding to this node
     VLOGS(logger, 1) << "Releasing node ML values.";
     ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan, logger));
+    frame.ReleaseScratchBuffers();
   }
 
 #ifdef ENABLE_NVTX_PROFILE
@@ -518,4 +518,3 @@ Status PartialExecutor::Execute(const SessionState& session_state, const std::ve
   return Status::OK();
 }
 }  // namespace onnxruntime
-#endif
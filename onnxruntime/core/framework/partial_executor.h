@@ -1,6 +1,5 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
-#ifdef ENABLE_TRAINING
 #pragma once
 
 #include <vector>
@@ -36,4 +35,3 @@ class PartialExecutor : public IExecutor {
   const OrtValueCachePtr& cache_;
 };
 }  // namespace onnxruntime
-#endif
\ No newline at end of file
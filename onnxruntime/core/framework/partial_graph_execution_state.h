@@ -3,12 +3,18 @@
 
 #pragma once
 
-#ifdef ENABLE_TRAINING
 #include "core/common/common.h"
 #include "core/framework/execution_frame.h"
 
 namespace onnxruntime {
 
+// This cache is also the seed for an operator-level result cache for
+// deterministic expensive subgraphs: PartialExecutor already consults it by
+// output name and short-circuits Compute on hit. Generalizing it to a
+// cross-Run cache requires keying by input-value digests and excluding
+// nondeterministic ops (Random*, Multinomial, anything seed-dependent) - the
+// digest cost bounds the win to expensive nodes over small inputs, the same
+// boundary as subgraph memoization.
 typedef std::unordered_map<std::string, OrtValue> OrtValueCache;
 typedef std::shared_ptr<OrtValueCache> OrtValueCachePtr;
 
@@ -47,4 +53,3 @@ struct PartialGraphExecutionState {
   size_t program_counter_end_;
 };
 }  // namespace onnxruntime
-#endif
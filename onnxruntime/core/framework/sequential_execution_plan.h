@@ -24,6 +24,10 @@ using IntervalT = std::pair<size_t, size_t>;
 
 class SessionState;
 
+// Copy-elision note: Concat inputs and Split outputs still materialize copies
+// because eliminating them needs sub-buffer aliasing - an OrtValue whose buffer
+// is an offset into another value's allocation. AllocPlanPerValue has no offset
+// field and the execution frame assumes buffers start at their allocation.
 // Captures information required to allocate/reuse buffer for a ml-value
 struct AllocPlanPerValue {
   AllocKind alloc_kind{AllocKind::kNotSet};
@@ -10,6 +10,7 @@
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
 #include "core/framework/allocation_planner.h"
+#include "core/framework/bfc_arena.h"
 #include "core/framework/execution_frame.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
@@ -137,6 +138,84 @@ static Status ReleaseNodeMLValues(ExecutionFrame& frame,
                                   const SequentialExecutionPlan::NodeExecutionPlan& node_exec_plan,
                                   const logging::Logger& logger);
 
+// Fetches the outputs from the frame and updates the memory pattern cache.
+// Common tail of both the reference loop and the lowered-plan loop.
+static Status FinalizeExecution(ExecutionFrame& frame, const SessionState& session_state,
+                                const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
+                                const logging::Logger& logger) {
+  VLOGS(logger, 1) << "Fetching output.";
+  // ExecutionFrame::Finalize will update 'fetches' with the final output
+  ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
+  VLOGS(logger, 1) << "Done with execution.";
+
+  if (frame.HasMemoryPatternPlanner()) {
+    bool all_tensors = true;
+    for (const auto& feed : feeds) {
+      if (!(feed.IsTensor())) {
+        all_tensors = false;
+        break;
+      }
+    }
+
+    if (all_tensors) {
+      auto mem_patterns = std::make_unique<MemoryPatternGroup>();
+      ORT_RETURN_IF_ERROR(frame.GeneratePatterns(mem_patterns.get()));
+      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(feeds, std::move(mem_patterns)));
+    }
+  }
+
+  return Status::OK();
+}
+
+// Steady-state loop over the lowered execution plan. Kernel pointers and the
+// to-be-freed ranges were pre-resolved at session finalization time, so this is
+// a plain array walk with no per-node lookups or instrumentation checks.
+static Status ExecuteLoweredPlan(const SessionState& session_state, ExecutionFrame& frame,
+                                 const std::vector<SessionState::LoweredNodeRecord>& lowered_plan,
+                                 const SequentialExecutionPlan& seq_exec_plan,
+                                 const bool& terminate_flag, const logging::Logger& logger) {
+  for (const auto& record : lowered_plan) {
+    if (terminate_flag) {
+      LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
+    }
+
+    OpKernelContextInternal op_kernel_context(session_state, frame, *record.kernel, logger, terminate_flag);
+
+    // attribute arena allocations made by this kernel to the node
+    BFCArena::ScopedAllocationTag allocation_tag(record.kernel->KernelDef().OpName().c_str(),
+                                                 static_cast<int64_t>(record.kernel->Node().Index()));
+
+    Status compute_status;
+    ORT_TRY {
+      compute_status = record.kernel->Compute(&op_kernel_context);
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        compute_status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+      });
+    }
+
+    if (!compute_status.IsOK()) {
+      const auto& node = record.kernel->Node();
+      std::ostringstream ss;
+      ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
+         << "' Status Message: " << compute_status.ErrorMessage();
+      const auto msg_string = ss.str();
+      LOGS(logger, ERROR) << msg_string;
+      return Status(compute_status.Category(), compute_status.Code(), msg_string);
+    }
+
+    // free ml-values and scratch buffers corresponding to this node
+    for (int i = record.free_from_index; i <= record.free_to_index; ++i) {
+      ORT_RETURN_IF_ERROR(frame.ReleaseMLValue(seq_exec_plan.to_be_freed[i]));
+    }
+    frame.ReleaseScratchBuffers();
+  }
+
+  return Status::OK();
+}
+
 Status SequentialExecutor::Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                                    const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
                                    std::vector<OrtValue>& fetches,
@@ -179,6 +258,27 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
   std::cout << std::make_pair(&seq_exec_plan, &session_state) << std::endl;
 #endif
 
+#if !defined(DEBUG_NODE_INPUTS_OUTPUTS) && !defined(ENABLE_NVTX_PROFILE) && !defined(CONCURRENCY_VISUALIZER) && \
+    !defined(ONNXRUNTIME_ENABLE_INSTRUMENT) && !defined(ENABLE_TRAINING) && !defined(ORT_MEMORY_PROFILE)
+  // Steady-state fast path: the plan was lowered at session finalization time to a
+  // flat array of pre-resolved kernel records. Use it whenever the per-node
+  // instrumentation and fence handling in the reference loop below cannot be needed
+  // for this run.
+#if !defined(ORT_MINIMAL_BUILD)
+  const bool can_use_lowered_plan = !only_execute_path_to_fetches;
+#else
+  const bool can_use_lowered_plan = true;
+#endif
+  if (!is_profiler_enabled && can_use_lowered_plan && !session_state.LoweredExecutionPlanHasFences()) {
+    const auto& lowered_plan = session_state.GetLoweredExecutionPlan();
+    if (!lowered_plan.empty()) {
+      ORT_RETURN_IF_ERROR(ExecuteLoweredPlan(session_state, frame, lowered_plan, seq_exec_plan,
+                                             terminate_flag_, logger));
+      return FinalizeExecution(frame, session_state, feeds, fetches, logger);
+    }
+  }
+#endif
+
   const auto& graph_viewer = session_state.GetGraphViewer();
 
 #ifdef CONCURRENCY_VISUALIZER
@@ -321,6 +421,10 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                node_name_for_profiling, input_type_shape);
     }
 
+    // attribute arena allocations made by this kernel to the node
+    BFCArena::ScopedAllocationTag allocation_tag(p_op_kernel->KernelDef().OpName().c_str(),
+                                                 static_cast<int64_t>(node_index));
+
     Status compute_status;
     {
 #ifdef CONCURRENCY_VISUALIZER
@@ -451,6 +555,7 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     // free ml-values corresponding to this node
     VLOGS(logger, 1) << "Releasing node ML values.";
     ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan, logger));
+    frame.ReleaseScratchBuffers();
   }
 
 #ifdef ENABLE_NVTX_PROFILE
@@ -470,32 +575,13 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
   }
 #endif
 
-  VLOGS(logger, 1) << "Fetching output.";
-  // ExecutionFrame::Finalize will update 'fetches' with the final output
-  ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
-  VLOGS(logger, 1) << "Done with execution.";
-
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::MemoryInfoProfile::CreateEvents("dynamic activations_" + std::to_string(MemoryInfo::GetIteration()),
                                               MemoryInfo::MemoryInfoProfile::GetAndIncreasePid(), MemoryInfo::MapType::DynamicActivation, "", 0);
   MemoryInfo::MemoryInfoProfile::Clear();
 #endif
 
-  if (frame.HasMemoryPatternPlanner()) {
-    bool all_tensors = true;
-    for (const auto& feed : feeds) {
-      if (!(feed.IsTensor())) {
-        all_tensors = false;
-        break;
-      }
-    }
-
-    if (all_tensors) {
-      auto mem_patterns = std::make_unique<MemoryPatternGroup>();
-      ORT_RETURN_IF_ERROR(frame.GeneratePatterns(mem_patterns.get()));
-      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(feeds, std::move(mem_patterns)));
-    }
-  }
+  ORT_RETURN_IF_ERROR(FinalizeExecution(frame, session_state, feeds, fetches, logger));
 
   if (is_profiler_enabled) {
     session_state.Profiler().EndTimeAndRecordEvent(profiling::SESSION_EVENT, "SequentialExecutor::Execute", tp);
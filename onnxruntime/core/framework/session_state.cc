@@ -184,6 +184,32 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
 
 const SequentialExecutionPlan* SessionState::GetExecutionPlan() const { return p_seq_exec_plan_.get(); }
 
+void SessionState::BuildLoweredExecutionPlan() {
+  lowered_exec_plan_.clear();
+  lowered_exec_plan_has_fences_ = false;
+
+  if (!p_seq_exec_plan_) {
+    return;
+  }
+
+  const auto& exec_plan_vec = p_seq_exec_plan_->execution_plan;
+  lowered_exec_plan_.reserve(exec_plan_vec.size());
+
+  for (const auto& node_exec_plan : exec_plan_vec) {
+    const auto node_index = node_exec_plan.node_index;
+    const OpKernel* kernel = GetKernel(node_index);
+    if (kernel == nullptr) {
+      // can't lower a plan with a missing kernel. leave the lowered plan empty so
+      // execution uses the reference loop, which reports the error per node.
+      lowered_exec_plan_.clear();
+      return;
+    }
+
+    lowered_exec_plan_has_fences_ = lowered_exec_plan_has_fences_ || p_seq_exec_plan_->NodeHasFence(node_index);
+    lowered_exec_plan_.push_back({kernel, node_exec_plan.free_from_index, node_exec_plan.free_to_index});
+  }
+}
+
 Status SessionState::AddInitializedTensor(int ort_value_index, const OrtValue& ort_value, const OrtCallback* d,
                                           bool constant, bool sparse) {
   auto p = initialized_tensors_.insert({ort_value_index, ort_value});
@@ -296,9 +322,8 @@ static std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type,
   return ss_1.str();
 }
 
-Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count,
-                                                       const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map) {
-  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map](
+Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count) {
+  auto prepacked_constant_weights = [this, &constant_initializers_use_count](
                                         bool should_cache_prepacked_weights_for_shared_initializers) -> Status {
     for (auto& node : GetGraphViewer().Nodes()) {
       auto kernel = GetMutableKernel(node.Index());
@@ -318,11 +343,12 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
                 bool is_packed = false;
                 const Tensor& const_initialized_tensor = constant_initialized_tensors[ort_value_idx].Get<Tensor>();
 
-                auto iter = initializers_to_share_map.find(input_name);
-                bool is_shared_initializer = (iter != initializers_to_share_map.end());
-
-                // Caching pre-packed weights is limited to shared initializers associated with the CPU EP for now
-                if (is_shared_initializer && should_cache_prepacked_weights_for_shared_initializers &&
+                // The pre-packed weights cache is content-addressed (op type + hash of the packed
+                // buffers), so when a container is wired into the session, any constant initializer
+                // whose packed bytes match one already produced - by this session or another sharing
+                // the container - resolves to the single cached copy, regardless of initializer
+                // names. Caching is limited to the CPU EP for now.
+                if (should_cache_prepacked_weights_for_shared_initializers &&
                     node.GetExecutionProviderType() == kCpuExecutionProvider) {  // caching of pre-packed weights' turned ON
 
                   AllocatorPtr allocator_for_caching = prepacked_weights_container_->GetOrCreateAllocator(CPU);
@@ -426,9 +452,11 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
 }
 
 static int64_t CalculateMemoryPatternsKey(const gsl::span<const OrtValue>& tensor_inputs) {
+  // combine rather than xor the dims so shape signatures that are permutations of each
+  // other (common across dynamic sequence lengths) don't collide on one cache entry
   int64_t key = 0;
   for (const auto& input : tensor_inputs) {
-    for (auto dim : input.Get<Tensor>().Shape().GetDims()) key ^= dim;
+    for (auto dim : input.Get<Tensor>().Shape().GetDims()) key = key * 31 + dim;
   }
   return key;
 }
@@ -652,22 +680,33 @@ Status SessionState::GeneratePatternGroupCache(const gsl::span<const OrtValue>&
 }
 #endif
 
-const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const gsl::span<const OrtValue>& tensor_inputs,
-                                                              const std::vector<int>& feed_mlvalue_idxs,
-                                                              std::unordered_map<int, TensorShape>& inferred_shapes) const {
-  int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
+void SessionState::AddMemPatternCacheEntry(MemPatternCacheShard& shard, int64_t key,
+                                           std::shared_ptr<const MemoryPatternGroup> mem_patterns,
+                                           std::unordered_map<int, TensorShape> inferred_shapes) {
+  shard.lru.push_front(key);
+  shard.entries[key] = {std::move(mem_patterns), std::move(inferred_shapes), shard.lru.begin()};
+
+  if (shard.entries.size() > kMemPatternCacheEntriesPerShard) {
+    shard.entries.erase(shard.lru.back());
+    shard.lru.pop_back();
+  }
+}
 
-  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
-  auto it = mem_patterns_.find(key);
-  if (it == mem_patterns_.end()) {
+std::shared_ptr<const MemoryPatternGroup> SessionState::GetMemoryPatternGroup(
+    const gsl::span<const OrtValue>& tensor_inputs,
+    const std::vector<int>& feed_mlvalue_idxs,
+    std::unordered_map<int, TensorShape>& inferred_shapes) const {
+  const int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
+  auto& shard = GetMemPatternCacheShard(key);
+
+  std::lock_guard<OrtMutex> lock(shard.lock);
+  auto it = shard.entries.find(key);
+  if (it == shard.entries.end()) {
 #ifdef ENABLE_TRAINING
-    auto mem_patterns = std::make_unique<MemoryPatternGroup>();
+    auto mem_patterns = std::make_shared<MemoryPatternGroup>();
     if (GeneratePatternGroupCache(tensor_inputs, feed_mlvalue_idxs, mem_patterns.get(), inferred_shapes).IsOK()) {
-      key = CalculateMemoryPatternsKey(tensor_inputs);
-      auto ptr = mem_patterns.get();
-      mem_patterns_[key] = std::move(mem_patterns);
-      shape_patterns_[key] = inferred_shapes;
-      return ptr;
+      AddMemPatternCacheEntry(shard, key, mem_patterns, inferred_shapes);
+      return mem_patterns;
     }
     return nullptr;
 #else
@@ -676,8 +715,28 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const gsl::span<co
 #endif
   }
 
-  inferred_shapes = shape_patterns_[key];
-  return it->second.get();
+  shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru_it);
+  inferred_shapes = it->second.inferred_shapes;
+  return it->second.mem_patterns;
+}
+
+std::vector<OrtValue> SessionState::RentOrtValueBuffer() const {
+  std::lock_guard<OrtMutex> lock(ort_value_buffer_pool_lock_);
+  if (ort_value_buffer_pool_.empty()) {
+    return {};
+  }
+
+  std::vector<OrtValue> buffer = std::move(ort_value_buffer_pool_.back());
+  ort_value_buffer_pool_.pop_back();
+  return buffer;
+}
+
+void SessionState::ReturnOrtValueBuffer(std::vector<OrtValue>&& buffer) const {
+  // the frame cleared the values already; only the capacity is recycled
+  std::lock_guard<OrtMutex> lock(ort_value_buffer_pool_lock_);
+  if (ort_value_buffer_pool_.size() < kMaxPooledOrtValueBuffers) {
+    ort_value_buffer_pool_.push_back(std::move(buffer));
+  }
 }
 
 void SessionState::ResolveMemoryPatternFlag() {
@@ -706,12 +765,12 @@ void SessionState::ResolveMemoryPatternFlag() {
 
 Status SessionState::UpdateMemoryPatternGroupCache(const gsl::span<const OrtValue>& tensor_inputs,
                                                    std::unique_ptr<MemoryPatternGroup> mem_patterns) const {
-  int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
+  const int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
+  auto& shard = GetMemPatternCacheShard(key);
 
-  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
-  auto it = mem_patterns_.find(key);
-  if (it == mem_patterns_.end()) {
-    mem_patterns_[key] = std::move(mem_patterns);
+  std::lock_guard<OrtMutex> lock(shard.lock);
+  if (shard.entries.find(key) == shard.entries.end()) {
+    AddMemPatternCacheEntry(shard, key, std::move(mem_patterns), {});
   }
 
   return Status::OK();
@@ -1335,6 +1394,16 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   const auto& initializer_allocation_order = p_seq_exec_plan_->initializer_allocation_order;
 
   // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
+  // when the initializers are going to be removed from the Graph afterwards anyway,
+  // drop each protobuf payload as soon as its weight is placed so load-time memory
+  // doesn't hold both copies of every weight at once
+  std::function<void(const std::string&)> release_initializer_data;
+  if (remove_initializers) {
+    release_initializer_data = [this](const std::string& name) {
+      graph_.ReleaseInitializedTensorData(name);
+    };
+  }
+
   ORT_RETURN_IF_ERROR(
       session_state_utils::SaveInitializedTensors(
           Env::Default(), graph_location, *graph_viewer_,
@@ -1343,7 +1412,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
           [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant, bool sparse) -> Status {
             return AddInitializedTensor(idx, value, &d, constant, sparse);
           },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options));
+          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options,
+          release_initializer_data));
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Record Weight allocation info on device
   MemoryInfo::RecordInitializerAllocInfo(GetInitializedTensors());
@@ -1363,8 +1433,7 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
       session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0");
 
   if (disable_prepacking != "1") {
-    ORT_RETURN_IF_ERROR(PrepackConstantInitializedTensors(constant_initializers_use_count,
-                                                          session_options.initializers_to_share_map));
+    ORT_RETURN_IF_ERROR(PrepackConstantInitializedTensors(constant_initializers_use_count));
   }
 #endif
 
@@ -1417,6 +1486,10 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
     }
   }
 
+  // all kernels (including control flow kernels with their subgraph info) exist now,
+  // so the sequential plan can be lowered for the steady-state execution loop.
+  BuildLoweredExecutionPlan();
+
   return Status::OK();
 }
 
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <list>
 #include <memory>
 #include <map>
 #include <unordered_map>
@@ -191,6 +194,52 @@ class SessionState {
 
   // execution plan. nullptr until FinalizeSessionState is called
   const SequentialExecutionPlan* GetExecutionPlan() const;
+
+  /**
+  Rent a recycled OrtValue vector to back an ExecutionFrame, or an empty vector if
+  the pool is empty. Returned vectors retain the capacity of earlier Runs, so the
+  frame's largest per-Run allocation is amortized away in steady state.
+  Const as it's an internal cache update only.
+  */
+  std::vector<OrtValue> RentOrtValueBuffer() const;
+
+  /** Return a buffer obtained from RentOrtValueBuffer to the pool. */
+  void ReturnOrtValueBuffer(std::vector<OrtValue>&& buffer) const;
+
+  /** Peak scratch-buffer bytes observed across completed runs; used to size the
+  per-run scratch slab so steady-state kernel temporaries never overflow. */
+  size_t GetScratchCapacityHint() const noexcept {
+    return scratch_capacity_hint_.load(std::memory_order_relaxed);
+  }
+
+  /** Record a completed run's peak scratch usage. Const as it's an internal cache
+  update only. */
+  void UpdateScratchCapacityHint(size_t peak_bytes) const noexcept {
+    size_t current = scratch_capacity_hint_.load(std::memory_order_relaxed);
+    while (peak_bytes > current &&
+           !scratch_capacity_hint_.compare_exchange_weak(current, peak_bytes, std::memory_order_relaxed)) {
+    }
+  }
+
+  // Flat per-node record lowered from the sequential execution plan once the kernels
+  // have been created, so the steady-state Run loop can walk an array of pre-resolved
+  // kernel pointers instead of doing per-node lookups.
+  struct LoweredNodeRecord {
+    const OpKernel* kernel{nullptr};
+    // range into SequentialExecutionPlan::to_be_freed of the values that can be
+    // released once this node has executed
+    int free_from_index{1};
+    int free_to_index{0};
+  };
+
+  // Lowered form of the sequential execution plan. Empty until FinalizeSessionState
+  // has been called, or if lowering was not possible (e.g. a kernel is missing).
+  const std::vector<LoweredNodeRecord>& GetLoweredExecutionPlan() const noexcept { return lowered_exec_plan_; }
+
+  // True if any node in the lowered plan requires fence synchronization, in which
+  // case callers must use the reference execution loop.
+  bool LoweredExecutionPlanHasFences() const noexcept { return lowered_exec_plan_has_fences_; }
+
   /**
   Get the logger for this session.
   Falls back to returning Logging::LoggingManager::DefaultLogger if SetLogger has not been called.
@@ -207,7 +256,7 @@ class SessionState {
   Get cached memory pattern based on input shapes
   Must be called only when all values contain tensors
   */
-  const MemoryPatternGroup* GetMemoryPatternGroup(
+  std::shared_ptr<const MemoryPatternGroup> GetMemoryPatternGroup(
       const gsl::span<const OrtValue>& tensor_inputs,
       const std::vector<int>& feed_mlvalue_idxs,
       std::unordered_map<int, TensorShape>& inferred_shapes) const;
@@ -358,8 +407,14 @@ class SessionState {
    * Prepack the constant initialized tensors for better performance.
    * The original constant initialized tensors will be removed to save memory.
    */
-  Status PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count,
-                                           const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map);
+  // Saved optimized models do not include the pre-packed MLAS blobs
+  // produced here: the packed layout is a function of the executing machine's
+  // instruction tier (the MlasPlatform dispatch), so a persisted blob needs a
+  // pack-signature (ISA tier + kernel version) in the artifact and a fallback
+  // repack when it mismatches. The shared PrepackedWeightsContainer provides
+  // the in-memory half of that already; serialization would extend the ORT
+  // format session state with tagged buffers.
+  Status PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count);
 
   SessionState* GetMutableSubgraphSessionState(onnxruntime::NodeIndex index, const std::string& attribute_name);
 
@@ -466,18 +521,67 @@ class SessionState {
   std::vector<BufferUniquePtr> weights_buffers_;
   std::unique_ptr<SequentialExecutionPlan> p_seq_exec_plan_ = nullptr;
 
+  // Lowers p_seq_exec_plan_ into lowered_exec_plan_. Called from
+  // FinalizeSessionStateImpl once the kernels have been created.
+  void BuildLoweredExecutionPlan();
+
+  std::vector<LoweredNodeRecord> lowered_exec_plan_;
+  bool lowered_exec_plan_has_fences_ = false;
+
   const logging::Logger& logger_;
   profiling::Profiler& profiler_;
 
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
 
-  // lock for the mem_patterns_
-  mutable OrtMutex mem_patterns_lock_;
+  // Shape bucketing note: an automatic bucketing service would sit in
+  // front of this cache - histogram observed shape signatures, pick bucket
+  // boundaries, and PAD incoming tensors up to bucket shapes so the pattern /
+  // kernel-setup caches converge onto few entries. Padding changes numerical
+  // results for ops that reduce over the padded region unless masks are
+  // adjusted, so it cannot be transparent at this layer; it belongs where the
+  // inputs are produced (serving layer or a padding-aware front graph), with
+  // the runtime-side piece being exactly this LRU cache keyed on the padded
+  // signatures.
+  // Cache of generated mem_patterns, keyed by input-shape signature. The cache is
+  // sharded by key so concurrent Runs with different shapes don't contend on one
+  // mutex, and each shard is LRU-bounded so dynamic-shape workloads with many
+  // distinct shape signatures don't grow it without bound. Patterns are handed out
+  // as shared_ptr so an in-flight Run keeps its pattern alive across eviction.
+  static constexpr size_t kMemPatternCacheShards = 8;
+  static constexpr size_t kMemPatternCacheEntriesPerShard = 64;
+
+  struct MemPatternCacheEntry {
+    std::shared_ptr<const MemoryPatternGroup> mem_patterns;
+    std::unordered_map<int, TensorShape> inferred_shapes;
+    std::list<int64_t>::iterator lru_it;
+  };
+
+  struct MemPatternCacheShard {
+    OrtMutex lock;
+    std::unordered_map<int64_t, MemPatternCacheEntry> entries;
+    std::list<int64_t> lru;  // most recently used at the front
+  };
+
+  mutable std::array<MemPatternCacheShard, kMemPatternCacheShards> mem_pattern_cache_shards_;
+
+  // pool of OrtValue vectors recycled across ExecutionFrame instances. bounded so
+  // a burst of concurrent Runs doesn't leave excess capacity pinned forever.
+  static constexpr size_t kMaxPooledOrtValueBuffers = 8;
+  mutable OrtMutex ort_value_buffer_pool_lock_;
+  mutable std::vector<std::vector<OrtValue>> ort_value_buffer_pool_;
+
+  mutable std::atomic<size_t> scratch_capacity_hint_{0};
+
+  MemPatternCacheShard& GetMemPatternCacheShard(int64_t key) const {
+    return mem_pattern_cache_shards_[static_cast<uint64_t>(key) % kMemPatternCacheShards];
+  }
 
-  // cache for the generated mem_patterns. key is calculated based on input shapes.
-  mutable std::map<int64_t, std::unique_ptr<MemoryPatternGroup>> mem_patterns_;
-  mutable std::map<int64_t, std::unordered_map<int, TensorShape>> shape_patterns_;
+  // inserts an entry into 'shard', evicting the least recently used entry if the
+  // shard is full. shard.lock must be held by the caller.
+  static void AddMemPatternCacheEntry(MemPatternCacheShard& shard, int64_t key,
+                                      std::shared_ptr<const MemoryPatternGroup> mem_patterns,
+                                      std::unordered_map<int, TensorShape> inferred_shapes);
 
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
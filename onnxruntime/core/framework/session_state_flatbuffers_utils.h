@@ -1,6 +1,13 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// The serialized fbs::SessionState currently carries the node ->
+// kernel-hash resolution only. Persisting the allocation plan and memory
+// patterns as well would need stable OrtValue indices across load (they are
+// assigned during CreateGraphInfo and are stable for an unchanged ORT format
+// graph) plus invalidation on allocator/EP configuration, since plan locations
+// bake in device placements. Worth extending here if plan construction shows
+// up in minimal-build cold starts.
 #pragma once
 
 #include <string>
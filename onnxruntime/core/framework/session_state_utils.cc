@@ -6,6 +6,8 @@
 
 #include <functional>
 #include <limits>
+#include <unordered_map>
+#include <unordered_set>
 #include <core/common/status.h>
 
 #include "core/common/common.h"
@@ -127,6 +129,73 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
   return common::Status::OK();
 }
 
+// Prefetch-hint note: first-layer weights are only "cold" when the
+// weight pages were never touched after load; the WarmUp API already prefaults
+// every initializer page, which subsumes per-inference prefetch hints for
+// weights. Software prefetch ahead of the FIRST node of a Run buys nothing
+// beyond that - by the time feeds are validated and the frame is built, a
+// prefetch issued at Run entry would have retired long before the first GEMM
+// touches the weights.
+// Weights larger than device memory: initializers are all
+// materialized on their planned device during this load path, so models larger
+// than GPU memory cannot initialize a CUDA-planned graph today. Overlapped
+// weight prefetch means leaving cold weights CPU-resident here and streaming
+// them in ahead of the executing node - which requires the executor to know
+// per-node weight residency and the planner to budget a streaming window;
+// neither exists yet, so partial placement via explicit device assignments per
+// subgraph is the workable pattern.
+// FNV-1a over the initializer's payload bytes; used to bucket candidates for
+// content dedup. Collisions are resolved with SameInitializerContent.
+static uint64_t HashInitializerContent(const ONNX_NAMESPACE::TensorProto& tensor_proto) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  auto mix = [&hash](const void* data, size_t len) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < len; ++i) {
+      hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+  };
+
+  const int32_t data_type = tensor_proto.data_type();
+  mix(&data_type, sizeof(data_type));
+  for (const auto dim : tensor_proto.dims()) {
+    mix(&dim, sizeof(dim));
+  }
+
+  if (utils::HasRawData(tensor_proto)) {
+    mix(tensor_proto.raw_data().data(), tensor_proto.raw_data().size());
+  } else {
+    ONNX_NAMESPACE::TensorProto copy = tensor_proto;
+    copy.clear_name();
+    const std::string serialized = copy.SerializeAsString();
+    mix(serialized.data(), serialized.size());
+  }
+
+  return hash;
+}
+
+static bool SameInitializerContent(const ONNX_NAMESPACE::TensorProto& lhs,
+                                   const ONNX_NAMESPACE::TensorProto& rhs) {
+  if (lhs.data_type() != rhs.data_type() || lhs.dims_size() != rhs.dims_size()) {
+    return false;
+  }
+  for (int i = 0; i < lhs.dims_size(); ++i) {
+    if (lhs.dims(i) != rhs.dims(i)) return false;
+  }
+
+  if (utils::HasRawData(lhs) && utils::HasRawData(rhs)) {
+    return lhs.raw_data() == rhs.raw_data();
+  }
+  if (utils::HasRawData(lhs) != utils::HasRawData(rhs)) {
+    return false;
+  }
+
+  ONNX_NAMESPACE::TensorProto lhs_copy = lhs;
+  ONNX_NAMESPACE::TensorProto rhs_copy = rhs;
+  lhs_copy.clear_name();
+  rhs_copy.clear_name();
+  return lhs_copy.SerializeAsString() == rhs_copy.SerializeAsString();
+}
+
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const AllocatorPtr& default_cpu_alloc,
@@ -136,7 +205,8 @@ common::Status SaveInitializedTensors(
     const SaveTensorFunction& save_tensor_func,
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options) {
+    const SessionOptions& session_options,
+    const std::function<void(const std::string& name)>& release_initializer_data) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -182,6 +252,59 @@ common::Status SaveInitializedTensors(
     id_to_initialized_tensor[ort_value_index] = entry.second;
   }
 
+  // Content-dedup identical constant initializers so they share one OrtValue:
+  // exporters commonly repeat mask constants, scales and position tables per branch,
+  // and each copy would otherwise get its own buffer. Candidates are constant,
+  // non-string, non-sparse initializers with inline data that aren't pinned to a
+  // specific allocation order and weren't supplied by the user.
+  std::unordered_set<int> ordered_allocation_ids(initializer_allocation_order.begin(),
+                                                 initializer_allocation_order.end());
+  std::unordered_map<int, int> initializer_alias;  // ort value id -> representative id
+  std::unordered_set<int> dedup_representatives;   // representatives with at least one alias
+  {
+    std::unordered_map<uint64_t, std::vector<int>> content_buckets;
+    for (const auto& entry : id_to_initialized_tensor) {
+      const int ort_value_id = entry.first;
+      const ONNX_NAMESPACE::TensorProto& tensor_proto = *entry.second;
+      const std::string& initializer_name = tensor_proto.name();
+
+      if (user_supplied_initializer_ids.count(ort_value_id) > 0 ||
+          ordered_allocation_ids.count(ort_value_id) > 0 ||
+          tensor_proto.data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING ||
+          utils::HasExternalData(tensor_proto) ||
+          !graph.IsConstantInitializer(initializer_name, /* check_outer_scope */ false)) {
+        continue;
+      }
+#if !defined(DISABLE_SPARSE_TENSORS)
+      if (graph.GetGraph().IsSparseInitializer(initializer_name)) {
+        continue;
+      }
+#endif
+
+      auto& bucket = content_buckets[HashInitializerContent(tensor_proto)];
+      int representative = -1;
+      for (int candidate : bucket) {
+        if (exec_plan.GetLocation(candidate) == exec_plan.GetLocation(ort_value_id) &&
+            SameInitializerContent(*id_to_initialized_tensor[candidate], tensor_proto)) {
+          representative = candidate;
+          break;
+        }
+      }
+
+      if (representative >= 0) {
+        initializer_alias[ort_value_id] = representative;
+        dedup_representatives.insert(representative);
+      } else {
+        bucket.push_back(ort_value_id);
+      }
+    }
+
+    if (!initializer_alias.empty()) {
+      LOGS(logger, INFO) << "De-duplicated " << initializer_alias.size()
+                         << " constant initializers by content.";
+    }
+  }
+
   // tensors requiring a specific allocation order are traced first, to ensure they are allocated in order
   auto initialized_tensors_to_allocate = id_to_initialized_tensor;
   for (int ort_value_index : initializer_allocation_order) {
@@ -201,6 +324,15 @@ common::Status SaveInitializedTensors(
       // do not trace string tensor
       continue;
     }
+    // initializers that will be used in place over in-memory bytes don't need a buffer
+    if (utils::HasExternalDataInMemory(*entry.second) &&
+        exec_plan.GetLocation(entry.first).device.Type() == OrtDevice::CPU) {
+      continue;
+    }
+    // aliased duplicates share their representative's buffer
+    if (initializer_alias.count(entry.first) > 0) {
+      continue;
+    }
     ORT_RETURN_IF_ERROR(planner.Trace(entry.first, entry.second));
   }
   //2. allocate weight buffer on different locations
@@ -223,21 +355,52 @@ common::Status SaveInitializedTensors(
   OrtCallback deleter{nullptr, nullptr};
 
   //3. create weight tensors based on weights buffer
+  std::unordered_map<int, OrtValue> deduped_values;  // representative id -> created value
   for (const auto& entry : id_to_initialized_tensor) {
     int ort_value_index = entry.first;
     const char* name = (entry.second->name().empty()) ? "" : entry.second->name().c_str();
     OrtValue ort_value;
 
-    if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
+    // aliased duplicates resolve to their representative's OrtValue. whichever group
+    // member is processed first materializes the shared value from the
+    // representative's planned buffer.
+    int create_index = ort_value_index;
+    const ONNX_NAMESPACE::TensorProto* create_proto = entry.second;
+    auto alias_it = initializer_alias.find(ort_value_index);
+    if (alias_it != initializer_alias.end()) {
+      create_index = alias_it->second;
+      create_proto = id_to_initialized_tensor[create_index];
+    }
+
+    auto cached_it = deduped_values.find(create_index);
+    if (cached_it != deduped_values.end()) {
+      ort_value = cached_it->second;
+    } else if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       ort_value = *(session_options.initializers_to_share_map.at(name));
       LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
-    } else {
+    } else if (utils::HasExternalDataInMemory(*entry.second) &&
+               exec_plan.GetLocation(ort_value_index).device.Type() == OrtDevice::CPU) {
+      // zero-copy: back the weight tensor directly with the in-memory bytes (e.g. the
+      // retained ORT format model buffer). no arena buffer was planned for it above.
       const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
+      void* data = nullptr;
+      size_t length = 0;
+      ORT_RETURN_IF_ERROR(utils::GetMemoryAddressExternalData(tensor_proto, data, length));
+
+      TensorShape tensor_shape{utils::GetTensorShapeFromTensorProto(tensor_proto)};
+      const auto* type = DataTypeImpl::TensorTypeFromONNXEnum(tensor_proto.data_type())->GetElementType();
+      ORT_RETURN_IF(length < tensor_shape.Size() * type->Size(),
+                    "In-memory external data for initializer '", name, "' is too small.");
+
+      Tensor::InitOrtValue(type, tensor_shape, data, exec_plan.GetLocation(ort_value_index), ort_value);
+    } else {
+      const ONNX_NAMESPACE::TensorProto& tensor_proto = *create_proto;
+      const char* create_name = (tensor_proto.name().empty()) ? "" : tensor_proto.name().c_str();
 
       std::unique_ptr<MemBuffer> m;
       AllocatorPtr alloc;
       // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
+      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(create_index, create_name, m, alloc));
       bool use_device_allocator_for_initializers =
           session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
 
@@ -245,9 +408,13 @@ common::Status SaveInitializedTensors(
                                          data_transfer_mgr, use_device_allocator_for_initializers);
       if (!st.IsOK()) {
         std::ostringstream oss;
-        oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
+        oss << "Deserialize tensor " << create_name << " failed." << st.ErrorMessage();
         return Status(st.Category(), st.Code(), oss.str());
       }
+
+      if (alias_it != initializer_alias.end() || dedup_representatives.count(create_index) > 0) {
+        deduped_values.emplace(create_index, ort_value);
+      }
     }
 
     // any outer scope value is shadowed by a local value and can't override it.
@@ -261,6 +428,13 @@ common::Status SaveInitializedTensors(
 #endif
 
     VLOGS(logger, 1) << "Added weight with name : " << name << " with index: " << ort_value_index;
+
+    // the weight now lives in its planned buffer; release the protobuf payload right
+    // away so peak memory during load stays bounded to one in-flight tensor
+    if (release_initializer_data &&
+        user_supplied_initializer_ids.find(entry.first) == user_supplied_initializer_ids.end()) {
+      release_initializer_data(name);
+    }
   }
 
   LOGS(logger, INFO) << "Done saving initialized tensors";
@@ -32,6 +32,9 @@ class Logger;
 namespace session_state_utils {
 using SaveTensorFunction = std::function<Status(int idx, const OrtValue& value, const OrtCallback& d,
                                                 bool constant, bool sparse)>;
+// 'release_initializer_data' is optionally invoked with the initializer's name once its
+// weight has been copied into SessionState, so the caller can drop the protobuf payload
+// immediately instead of keeping every copy alive until the whole load completes.
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const AllocatorPtr& default_cpu_memory_info,
@@ -41,7 +44,8 @@ common::Status SaveInitializedTensors(
     const logging::Logger& logger,
     const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options);
+    const SessionOptions& session_options,
+    const std::function<void(const std::string& name)>& release_initializer_data = {});
 common::Status SaveInputOutputNamesToNodeMapping(const GraphViewer& graph,
                                                  SessionState& session_state,
                                                  const std::vector<const NodeArg*>& implicit_inputs);
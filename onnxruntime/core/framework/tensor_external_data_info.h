@@ -8,6 +8,12 @@
 #include "core/session/onnxruntime_c_api.h"
 
 namespace onnxruntime {
+// External data entries are raw byte ranges today. Transparent
+// compressed weights would extend this record with a codec tag and compressed
+// length, decode block-wise into the planned buffer during the session-state
+// load loop, and keep mmap-based zero copy for the uncompressed case.
+// Decompression sits on the load path, so it only pays where disk or image
+// size dominates cold start.
 class ExternalDataInfo {
  private:
 #ifdef _WIN32
@@ -9,6 +9,7 @@
 #include <gsl/gsl>
 
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/framework/endian_utils.h"
 #include "core/framework/op_kernel.h"
@@ -597,6 +598,41 @@ static Status GetFileContent(
  * @param tensorp       pre-allocated tensor object, where we store the data
  * @return
  */
+bool HasExternalDataInMemory(const ONNX_NAMESPACE::TensorProto& tensor_proto) {
+  if (!HasExternalData(tensor_proto)) return false;
+
+  for (const auto& entry : tensor_proto.external_data()) {
+    if (entry.key() == "location") {
+      return entry.value() == kTensorProtoMemoryAddressTag;
+    }
+  }
+
+  return false;
+}
+
+common::Status GetMemoryAddressExternalData(const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                            void*& data, size_t& length) {
+  ORT_RETURN_IF_NOT(HasExternalDataInMemory(tensor_proto),
+                    "Tensor does not have in-memory external data.");
+
+  data = nullptr;
+  length = 0;
+  for (const auto& entry : tensor_proto.external_data()) {
+    if (entry.key() == "offset") {
+      uintptr_t address = 0;
+      ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale(entry.value(), address),
+                        "Invalid in-memory external data offset: ", entry.value());
+      data = reinterpret_cast<void*>(address);
+    } else if (entry.key() == "length") {
+      ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale(entry.value(), length),
+                        "Invalid in-memory external data length: ", entry.value());
+    }
+  }
+
+  ORT_RETURN_IF(data == nullptr, "Missing address for in-memory external data.");
+  return Status::OK();
+}
+
 Status TensorProtoToTensor(const Env& env, const ORTCHAR_T* model_path,
                            const ONNX_NAMESPACE::TensorProto& tensor_proto,
                            Tensor& tensor) {
@@ -616,7 +652,13 @@ Status TensorProtoToTensor(const Env& env, const ORTCHAR_T* model_path,
   SafeInt<size_t> raw_data_len = 0;
   AutoDelete deleter_for_file_data;
 
-  if (utils::HasExternalData(tensor_proto)) {
+  if (utils::HasExternalDataInMemory(tensor_proto)) {
+    // the data lives at a recorded memory address (e.g. retained ORT format model
+    // bytes); read it from there instead of from a file
+    size_t mem_length = 0;
+    ORT_RETURN_IF_ERROR(utils::GetMemoryAddressExternalData(tensor_proto, raw_data, mem_length));
+    raw_data_len = mem_length;
+  } else if (utils::HasExternalData(tensor_proto)) {
     // Get the external data info
     std::basic_string<ORTCHAR_T> external_data_file_path;
     FileOffsetType file_offset;
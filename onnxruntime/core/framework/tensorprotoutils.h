@@ -283,6 +283,20 @@ inline bool HasRawData(const ONNX_NAMESPACE::TensorProto& ten_proto) {
          ten_proto.has_raw_data();  // XXX: Figure out how to do in proto3
 }
 
+// An initializer whose external data 'location' equals this tag keeps its data at a
+// memory address recorded in the 'offset' entry (e.g. inside retained ORT format
+// model bytes) instead of in a file. Such data can back a Tensor without a copy.
+constexpr const char* kTensorProtoMemoryAddressTag = "*/_ORT_MEM_ADDR_/*";
+
+// True if tensor_proto's external data lives at an in-memory address (see
+// kTensorProtoMemoryAddressTag).
+bool HasExternalDataInMemory(const ONNX_NAMESPACE::TensorProto& tensor_proto);
+
+// Retrieves the data pointer and byte length of an initializer whose external data
+// lives at an in-memory address.
+common::Status GetMemoryAddressExternalData(const ONNX_NAMESPACE::TensorProto& tensor_proto,
+                                            void*& data, size_t& length);
+
 inline bool HasExternalData(const ONNX_NAMESPACE::TensorProto& ten_proto) {
   // Can not be UNDEFINED and can not be STRING but test for STRING is usually performed separately
   // to return an error
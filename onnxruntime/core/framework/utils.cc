@@ -19,8 +19,8 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/mlas/inc/mlas.h"
 #include "core/framework/TensorSeq.h"
+#include "core/framework/partial_executor.h"
 #ifdef ENABLE_TRAINING
-#include "core/framework/orttraining_partial_executor.h"
 #include "orttraining/training_ops/cpu/aten_ops/aten_op_executor.h"
 #endif
 
@@ -269,11 +269,7 @@ static common::Status CalculateStaticCopyInfoForFeed(const SessionState& session
                                                      const std::string& input_name,
                                                      MLValueCopyInfo& copy_info) {
   std::vector<SessionState::NodeInfo> node_info_vec;
-#ifdef ENABLE_TRAINING
   if (session_state.GetInputNodeInfo(input_name, node_info_vec) == Status::OK()) {
-#else
-  ORT_RETURN_IF_ERROR(session_state.GetInputNodeInfo(input_name, node_info_vec));
-#endif
     const auto& node_info = node_info_vec.front();  // all consumers of a feed have the same device so first entry is fine
 
     if (node_info.p_node == nullptr) {
@@ -283,7 +279,6 @@ static common::Status CalculateStaticCopyInfoForFeed(const SessionState& session
 
     copy_info.target_device = *node_info.device;
 
-#ifdef ENABLE_TRAINING
   } else {
     // This input might be for an intermediate tensor for partial graph execution.
     const auto* exec_plan = session_state.GetExecutionPlan();
@@ -293,7 +288,6 @@ static common::Status CalculateStaticCopyInfoForFeed(const SessionState& session
     const auto& device = exec_plan->GetLocation(index).device;
     copy_info.target_device = device;
   }
-#endif
 
   return Status::OK();
 }
@@ -637,7 +631,6 @@ common::Status ExecuteGraph(const SessionState& session_state,
   return status;
 }
 
-#ifdef ENABLE_TRAINING
 common::Status ExecutePartialGraph(const SessionState& session_state, FeedsFetchesManager& feeds_fetches_manager,
                                    const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                                    const logging::Logger& logger, PartialGraphExecutionState& state,
@@ -698,7 +691,6 @@ common::Status ExecutePartialGraph(const SessionState& session_state, FeedsFetch
 
   return Status::OK();
 }
-#endif
 
 common::Status ExecuteSubgraph(const SessionState& session_state, const FeedsFetchesManager& feeds_fetches_manager,
                                const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
@@ -522,6 +522,26 @@ ONNX_MS_OPERATOR_SET_SCHEMA(BiasGelu, 1,
                                     "Constrain input and output types to float tensors.")
                                 .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
 
+constexpr const char* FusedElementwise_ver1_doc =
+    R"DOC(Evaluates a chain of elementwise operations in a single pass over memory.
+Produced by the ElementwiseChainFusion graph transformer; not intended to be authored directly.
+The i-th entry of 'operators' names the i-th operation of the chain, applied in order to the input.
+Each binary operation consumes the next unused entry of 'scalars' as its constant operand.)DOC";
+ONNX_MS_OPERATOR_SET_SCHEMA(FusedElementwise, 1,
+                            OpSchema()
+                                .SetDoc(FusedElementwise_ver1_doc)
+                                .Attr("operators", "Elementwise operations to apply, in order.",
+                                      AttributeProto::STRINGS)
+                                .Attr("scalars", "Constant scalar operands of the binary operations, in order.",
+                                      AttributeProto::FLOATS, OPTIONAL_VALUE)
+                                .Input(0, "X", "The input tensor.", "T")
+                                .Output(0, "Y", "The output tensor.", "T")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(float)"},
+                                    "Constrain input and output types to float tensors.")
+                                .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
+
 // Used to be ONNX 1.7 Inverse(12)
 // Comment out docs not to increase the binary size
 //
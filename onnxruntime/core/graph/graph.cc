@@ -2856,6 +2856,24 @@ bool Graph::IsSparseInitializer(const std::string& name) const {
 }
 #endif
 
+void Graph::ReleaseInitializedTensorData(const std::string& tensor_name) {
+  auto iter = name_to_initial_tensor_.find(tensor_name);
+  if (iter == name_to_initial_tensor_.end()) {
+    return;
+  }
+
+  // the map holds pointers into memory owned by graph_proto_, so in-place mutation
+  // is safe and doesn't disturb the other initializer entries
+  auto& tensor_proto = *const_cast<ONNX_NAMESPACE::TensorProto*>(iter->second);
+  tensor_proto.clear_raw_data();
+  tensor_proto.clear_float_data();
+  tensor_proto.clear_int32_data();
+  tensor_proto.clear_string_data();
+  tensor_proto.clear_int64_data();
+  tensor_proto.clear_double_data();
+  tensor_proto.clear_uint64_data();
+}
+
 void Graph::RemoveInitializedTensor(const std::string& tensor_name) {
   bool found = false;
   auto iter = name_to_initial_tensor_.find(tensor_name);
@@ -4267,6 +4285,13 @@ Graph::Graph(const Model& owning_model,
       is_loaded_from_model_file_(true) {  // true as the Graph isn't manually constructed from scratch
 }
 
+// Subgraphs of control-flow nodes are materialized eagerly below via
+// the node/attribute loading even when the branch never executes. Lazy
+// materialization needs the session-state finalization split per subgraph
+// (kernels, plans and initializers are built for every nested graph during
+// Initialize), so it is an InferenceSession-level staging change; this loader
+// could defer fbs::Graph decoding trivially once finalization can run on
+// demand.
 common::Status Graph::LoadFromOrtFormat(const onnxruntime::fbs::Graph& fbs_graph) {
   // We deserialize the graph from ORT format in the following order:
   // 1. Deserialize the initializers and sparse initializers. Convert sparse to dense.
@@ -4297,7 +4322,8 @@ common::Status Graph::LoadFromOrtFormat(const onnxruntime::fbs::Graph& fbs_graph
     for (const auto* fbs_tensor : *fbs_initializers) {
       ORT_RETURN_IF(nullptr == fbs_tensor, "Initializer tensor is missing. Invalid ORT format model.");
       TensorProto* initializer = deserialized_proto_data_.add_initializer();
-      ORT_RETURN_IF_ERROR(fbs::utils::LoadInitializerOrtFormat(*fbs_tensor, *initializer));
+      ORT_RETURN_IF_ERROR(fbs::utils::LoadInitializerOrtFormat(*fbs_tensor, *initializer,
+                                                               owning_model_.OrtFormatLoadOptions()));
       auto p = name_to_initial_tensor_.emplace(initializer->name(), initializer);
       if (!p.second) {
         LOGS(logger_, WARNING) << "Duplicate initializer (dense or ConstantNode): '" << initializer->name()
@@ -172,7 +172,8 @@ Status SaveAttributeOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 #endif
 
 Status LoadInitializerOrtFormat(const fbs::Tensor& fbs_tensor,
-                                TensorProto& initializer) {
+                                TensorProto& initializer,
+                                const OrtFormatLoadOptions& load_options) {
   initializer.Clear();
 
   LOAD_STR_FROM_ORT_FORMAT(initializer, name, fbs_tensor.name());
@@ -196,8 +197,31 @@ Status LoadInitializerOrtFormat(const fbs::Tensor& fbs_tensor,
     const auto* fbs_raw_data = fbs_tensor.raw_data();
     ORT_RETURN_IF(nullptr == fbs_raw_data, "Missing raw data for initializer. Invalid ORT format model.");
 
-    // fbs_raw_data is uint8_t vector, so the size is byte size
-    initializer.set_raw_data(fbs_raw_data->Data(), fbs_raw_data->size());
+    if (load_options.can_use_flatbuffer_for_initializers && fbs_raw_data->size() > 0) {
+      // reference the flatbuffer bytes in place instead of copying them. downstream
+      // consumers recognize the memory-address external data entries and can back the
+      // weight tensor directly with this pointer (see utils::kTensorProtoMemoryAddressTag).
+      static_assert(FLATBUFFERS_LITTLEENDIAN, "ORT format only supports little-endian machines");
+      const void* data_offset = fbs_raw_data->Data();
+      auto* external_data = initializer.mutable_external_data();
+
+      auto* location_entry = external_data->Add();
+      location_entry->set_key("location");
+      location_entry->set_value(onnxruntime::utils::kTensorProtoMemoryAddressTag);
+
+      auto* offset_entry = external_data->Add();
+      offset_entry->set_key("offset");
+      offset_entry->set_value(std::to_string(reinterpret_cast<uintptr_t>(data_offset)));
+
+      auto* length_entry = external_data->Add();
+      length_entry->set_key("length");
+      length_entry->set_value(std::to_string(fbs_raw_data->size()));
+
+      initializer.set_data_location(ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL);
+    } else {
+      // fbs_raw_data is uint8_t vector, so the size is byte size
+      initializer.set_raw_data(fbs_raw_data->Data(), fbs_raw_data->size());
+    }
   }
 
   return Status::OK();
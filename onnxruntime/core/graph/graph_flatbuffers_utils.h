@@ -49,8 +49,16 @@ onnxruntime::common::Status SaveAttributeOrtFormat(
     flatbuffers::Offset<fbs::Attribute>& fbs_attr, const Path& model_path,
     const onnxruntime::Graph* subgraph);
 
+// Options to configure how ORT format initializer data is materialized.
+struct OrtFormatLoadOptions {
+  // Initializers reference the flatbuffer bytes directly instead of copying them.
+  // Requires the serialized model bytes to outlive the Graph (and any session over it).
+  bool can_use_flatbuffer_for_initializers = false;
+};
+
 onnxruntime::common::Status LoadInitializerOrtFormat(
-    const fbs::Tensor& fbs_tensor, ONNX_NAMESPACE::TensorProto& initializer);
+    const fbs::Tensor& fbs_tensor, ONNX_NAMESPACE::TensorProto& initializer,
+    const OrtFormatLoadOptions& load_options = {});
 
 onnxruntime::common::Status LoadSparseInitializerOrtFormat(const fbs::SparseTensor& fbs_sparse_tensor,
                                                            ONNX_NAMESPACE::SparseTensorProto& initializer);
@@ -106,6 +106,13 @@ Model::Model(const ModelProto& model_proto, const PathString& model_path,
     : Model(ModelProto(model_proto), model_path, local_registries, logger, allow_released_opsets_only) {
 }
 
+// Parse-time note: ModelProto deserialization is a single
+// protobuf::ParseFromArray - protobuf offers no intra-message parallel parse,
+// and initializers are length-delimited fields whose boundaries are only known
+// while scanning, so parallelizing requires a custom two-pass reader (index the
+// top-level field offsets, then parse initializer payloads concurrently).
+// The supported mitigations are external data files (weights bypass protobuf
+// entirely) and the ORT flatbuffers format (no parse at all).
 Model::Model(ModelProto&& model_proto, const PathString& model_path,
              const IOnnxRuntimeOpSchemaRegistryList* local_registries,
              const logging::Logger& logger, bool allow_released_opsets_only)
@@ -729,8 +736,10 @@ common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
                                         const IOnnxRuntimeOpSchemaRegistryList* local_registries,
 #endif
                                         const logging::Logger& logger,
-                                        std::unique_ptr<Model>& model) {
+                                        std::unique_ptr<Model>& model,
+                                        const fbs::utils::OrtFormatLoadOptions& load_options) {
   model = std::make_unique<Model>();
+  model->ort_format_load_options_ = load_options;
 
   // Load the model metadata
   if (const auto* fbs_metadata_props = fbs_model.metadata_props()) {
@@ -9,6 +9,7 @@
 #include <string>
 #include "core/common/path.h"
 #include "core/graph/graph_viewer.h"
+#include "core/graph/graph_flatbuffers_utils.h"
 #include "core/session/onnxruntime_c_api.h"
 #include "gsl/gsl"
 
@@ -270,11 +271,19 @@ class Model {
                                           const IOnnxRuntimeOpSchemaRegistryList* local_registries,
 #endif
                                           const logging::Logger& logger,
-                                          std::unique_ptr<Model>& model);
+                                          std::unique_ptr<Model>& model,
+                                          const fbs::utils::OrtFormatLoadOptions& load_options = {});
+
+  // How ORT format initializer data is materialized for this model's graphs.
+  const fbs::utils::OrtFormatLoadOptions& OrtFormatLoadOptions() const noexcept {
+    return ort_format_load_options_;
+  }
 
   Model();
 
  private:
+  fbs::utils::OrtFormatLoadOptions ort_format_load_options_;
+
   // Model data.
 #if !defined(ORT_MINIMAL_BUILD)
   ONNX_NAMESPACE::ModelProto model_proto_;
@@ -118,6 +118,11 @@ MlasGetPreferredBufferAlignment(
 // Activation routines.
 //
 
+// MlasActivation is the fused post-accumulation epilogue: it applies the kinds
+// below (optionally with bias) to output tiles while resident, and
+// FusedConv/FusedGemm route through it. Gelu variants are absent because their
+// erf/tanh cores live in the standalone transcendental kernels rather than the
+// activation template framework in activate.cpp.
 enum MLAS_ACTIVATION_KIND {
     MlasIdentityActivation,
     MlasReluActivation,
@@ -166,6 +171,12 @@ MlasActivation(
 /**
  * @brief Supply matrices data information to single precision gemm functions
  */
+// Precision note: CPU GEMM accumulates in fp32; fp16 is a storage
+// type only (converted via the F16C buffer routines before compute). True
+// fp16-accumulate kernels need hardware fp16 FMA (AVX512-FP16 / NEON FP16
+// arithmetic), a new MLAS kernel tier, and an opt-in since fp16 accumulation
+// changes results materially for long reductions - storage-side fp16 with fp32
+// accumulate is the supported configuration at this version.
 struct MLAS_SGEMM_DATA_PARAMS {
     const float* A = nullptr; /**< Supplies the address of matrix A */
     size_t lda = 0;           /**< Supplies the first dimension of matrix A. */
@@ -660,6 +671,78 @@ MlasGemmPackB(
     void* PackedB
     );
 
+/**
+ * @brief Returns true when the processor has native bfloat16 dot-product support
+ *        (AVX512-BF16); used to steer bf16 storage decisions. Note bf16 compute
+ *        kernels are not available yet.
+ */
+bool
+MLASCALL
+MlasBf16AccelerationSupported(
+    void
+    );
+
+/**
+ * @brief Converts a buffer of single precision values to bfloat16 storage with
+ *        round-to-nearest-even.
+ */
+void
+MLASCALL
+MlasConvertFloatToBFloat16(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    );
+
+/**
+ * @brief Converts a buffer of bfloat16 values to single precision.
+ */
+void
+MLASCALL
+MlasConvertBFloat16ToFloat(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    );
+
+/**
+ * @brief Sets the capacity (in entries) of the opt-in packed-B cache consulted by the
+ *        float MlasGemmBatch path. Only B pointers explicitly registered via
+ *        MlasSgemmPackBCacheRegister participate - unseen pointers are never cached,
+ *        so re-materialized activation buffers cannot silently serve stale packed
+ *        data. 0 (the default) disables the cache and drops all packed entries.
+ */
+void
+MLASCALL
+MlasSgemmSetPackBCacheCapacity(
+    size_t Capacity
+    );
+
+/**
+ * @brief Registers a B pointer as eligible for the packed-B cache. Entries are keyed
+ *        by (pointer, generation, transpose, shape, leading dimension); registering a
+ *        pointer that is already registered bumps its generation, which invalidates
+ *        any packed data captured from the previous contents. The caller must call
+ *        this again (or MlasSgemmPackBCacheInvalidate) whenever the bytes behind the
+ *        pointer change.
+ */
+void
+MLASCALL
+MlasSgemmPackBCacheRegister(
+    const float* B
+    );
+
+/**
+ * @brief Invalidates the packed-B cache: bumps the generation of the given registered
+ *        B pointer (dropping its packed data), or clears all entries and
+ *        registrations when B is nullptr.
+ */
+void
+MLASCALL
+MlasSgemmPackBCacheInvalidate(
+    const float* B
+    );
+
 size_t
 MLASCALL
 MlasGemmPackBSize(
@@ -897,6 +980,13 @@ MlasMaximumPool(
 // Miscellaneous compute routines.
 //
 
+//
+// Transcendental coverage: exp, erf, tanh, logistic and the fused
+// softmax/log-softmax paths below are the vectorized kernels the CPU EP
+// routes through. Elementwise Log/Softplus evaluate via Eigen packet math;
+// a dedicated log kernel would follow the MlasComputeExp structure.
+//
+
 void
 MLASCALL
 MlasComputeErf(
@@ -0,0 +1,71 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bfloat16.cpp
+
+Abstract:
+
+    This module implements routines to convert between single precision and
+    bfloat16 storage, plus the query for native bfloat16 dot-product support.
+    These are the storage-side building blocks for a bf16 compute tier; the
+    GEMM/conv kernels themselves are not implemented yet.
+
+--*/
+
+#include "mlasi.h"
+
+bool
+MLASCALL
+MlasBf16AccelerationSupported(
+    void
+    )
+{
+#if defined(MLAS_TARGET_AMD64)
+    return GetMlasPlatform().HasAvx512Bf16;
+#else
+    return false;
+#endif
+}
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    )
+{
+    for (size_t i = 0; i < Count; i++) {
+
+        uint32_t Bits;
+        memcpy(&Bits, &Source[i], sizeof(Bits));
+
+        if ((Bits & 0x7F800000) == 0x7F800000 && (Bits & 0x007FFFFF) != 0) {
+            // preserve NaN without letting the rounding bias flip it to infinity
+            Destination[i] = uint16_t((Bits >> 16) | 0x0040);
+        } else {
+            // round to nearest even
+            const uint32_t RoundingBias = 0x7FFF + ((Bits >> 16) & 1);
+            Destination[i] = uint16_t((Bits + RoundingBias) >> 16);
+        }
+    }
+}
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloat(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    )
+{
+    for (size_t i = 0; i < Count; i++) {
+        const uint32_t Bits = uint32_t(Source[i]) << 16;
+        memcpy(&Destination[i], &Bits, sizeof(Bits));
+    }
+}
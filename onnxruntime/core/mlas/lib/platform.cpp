@@ -296,6 +296,13 @@ Return Value:
                 // Check if the processor supports AVX512F features and the
                 // operating system supports saving AVX512F state.
                 //
+                // N.B. The AVX512F SGEMM/DGEMM/conv tier and the AVX512 Core /
+                // AVX512VNNI QGEMM tiers below are the widest kernels MLAS ships;
+                // they are compiled out of minimal builds to keep the binary
+                // small, so deployments that appear to "top out at AVX2" on
+                // AVX512-capable parts are almost always running a minimal build
+                // (or an OS that doesn't enable the ZMM state in XCR0).
+                //
 
                 if (((Cpuid7[1] & 0x10000) != 0) && ((xcr0 & 0xE0) == 0xE0)) {
 
@@ -338,6 +345,14 @@ Return Value:
                             this->GemvU8S8Kernel = MlasGemvU8S8KernelAvx512Vnni;
                             this->ConvSymU8S8Dispatch = &MlasConvSymDispatchAvx512Vnni;
                         }
+
+                        //
+                        // Check if the processor supports AVX512-BF16 (CPUID.7.1:EAX[5]).
+                        // No bf16 compute kernels ship yet; callers can query the flag
+                        // through MlasBf16AccelerationSupported to steer bf16 storage.
+                        //
+
+                        this->HasAvx512Bf16 = (Cpuid7_1[0] & 0x20) != 0;
                     }
                 }
 
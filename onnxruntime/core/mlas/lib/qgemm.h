@@ -28,6 +28,13 @@ Abstract:
 
 --*/
 
+// Int4 note: there is no 4-bit element type in the ONNX/ORT type
+// system at this version, so int4 weight storage cannot be expressed as a
+// tensor; the workable shape is a contrib op carrying packed nibbles as uint8
+// with a group-quantization scale table, plus QGEMM kernels that unpack two
+// nibbles per byte in the B-panel copy routines below. The packing layer is
+// where unpack-on-the-fly belongs - the inner kernels should keep consuming
+// s8 panels.
 #pragma once
 
 #include "mlasi.h"
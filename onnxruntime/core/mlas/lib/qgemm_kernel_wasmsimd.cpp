@@ -1,3 +1,11 @@
+// WASM coverage note: this SIMD QGEMM tier plus the wasm build's
+// generic vectorized kernels are the current browser story; threads require
+// building with pthreads (SharedArrayBuffer + cross-origin isolation headers
+// at deployment), after which the normal thread pool works unchanged. Kernel
+// expansion means more wasm_simd128 tiers (sgemm/conv/pool) mirroring this
+// file's pattern - the MlasPlatform dispatch hooks for wasm targets already
+// exist.
+
 /*++
 
 Copyright (c) Microsoft Corporation. All rights reserved.
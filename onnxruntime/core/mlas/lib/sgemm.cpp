@@ -17,6 +17,12 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 //
 // Define the number of rows from matrix A to transpose to a local buffer.
 //
@@ -1552,6 +1558,248 @@ Return Value:
             DataParams->alpha, A, lda, B, ldb, DataParams->beta, C, ldc);
     }
 }
+// Kernel choice inside MlasGemmBatch is already shape-driven (M == 1 row path,
+// small-N handling, platform dispatch) and deterministic from shape and ISA, so
+// there is no benchmark-dependent selection to persist on the float path.
+//
+// Opt-in cache of packed B panels for repeated GEMMs against the same
+// activation-derived B matrix (e.g. the scores @ V matmul of a decoder executed
+// once per step). Only explicitly registered B pointers participate, and every
+// registration carries a generation that is part of the cache key: re-registering
+// (or invalidating) a pointer bumps the generation, so packed data captured from
+// earlier contents of a re-materialized buffer can never be served. Storage is
+// reference counted so an entry evicted mid-GEMM stays alive until the GEMM
+// finishes.
+//
+
+namespace {
+
+struct MLAS_SGEMM_PACKB_CACHE_ENTRY {
+    const float* B = nullptr;
+    uint64_t Generation = 0;
+    CBLAS_TRANSPOSE TransB = CblasNoTrans;
+    size_t N = 0;
+    size_t K = 0;
+    size_t ldb = 0;
+    uint64_t LastUsed = 0;
+    std::shared_ptr<void> PackedB;
+};
+
+struct MLAS_SGEMM_PACKB_CACHE {
+    std::mutex Lock;
+    size_t Capacity = 0;
+    uint64_t UseCounter = 0;
+    std::vector<MLAS_SGEMM_PACKB_CACHE_ENTRY> Entries;
+    std::unordered_map<const float*, uint64_t> RegisteredGenerations;
+};
+
+//
+// Lock-free gate consulted on the GEMM hot path: MlasGemmBatch only touches the
+// cache (and its mutex) when this is non-zero, so the default-disabled
+// configuration adds a single relaxed load to each GEMM call.
+//
+
+std::atomic<size_t> MlasSgemmPackBCacheEnabled{0};
+
+MLAS_SGEMM_PACKB_CACHE&
+MlasSgemmPackBCache(
+    void
+    )
+{
+    static MLAS_SGEMM_PACKB_CACHE Cache;
+    return Cache;
+}
+
+MLAS_SGEMM_PACKB_CACHE_ENTRY*
+MlasSgemmPackBCacheFindEntry(
+    MLAS_SGEMM_PACKB_CACHE& Cache,
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    uint64_t Generation
+    )
+{
+    for (auto& Entry : Cache.Entries) {
+        if (Entry.B == B && Entry.Generation == Generation && Entry.TransB == TransB &&
+            Entry.N == N && Entry.K == K && Entry.ldb == ldb) {
+            return &Entry;
+        }
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<void>
+MlasSgemmPackBCacheLookupOrPack(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb
+    )
+{
+    MLAS_SGEMM_PACKB_CACHE& Cache = MlasSgemmPackBCache();
+
+    uint64_t Generation;
+
+    {
+        std::lock_guard<std::mutex> Lock(Cache.Lock);
+
+        if (Cache.Capacity == 0) {
+            return nullptr;
+        }
+
+        //
+        // Only registered pointers are cached; the registration's generation is
+        // part of the key, so an entry packed from earlier contents of this
+        // buffer misses.
+        //
+
+        auto RegisteredIt = Cache.RegisteredGenerations.find(B);
+        if (RegisteredIt == Cache.RegisteredGenerations.end()) {
+            return nullptr;
+        }
+        Generation = RegisteredIt->second;
+
+        MLAS_SGEMM_PACKB_CACHE_ENTRY* Entry =
+            MlasSgemmPackBCacheFindEntry(Cache, TransB, N, K, B, ldb, Generation);
+        if (Entry != nullptr) {
+            Entry->LastUsed = ++Cache.UseCounter;
+            return Entry->PackedB;
+        }
+    }
+
+    //
+    // Miss: pack outside the lock so an O(N*K) pack doesn't stall every other
+    // GEMM. The buffer is over-allocated so the packed panels start at the
+    // preferred alignment regardless of what operator new returned.
+    //
+
+    const size_t AlignedSize = MlasGemmPackBSize(N, K) + 64;
+    std::shared_ptr<void> Storage(::operator new(AlignedSize), [](void* p) { ::operator delete(p); });
+    void* PackedB = reinterpret_cast<void*>(
+        (reinterpret_cast<uintptr_t>(Storage.get()) + 63) & ~uintptr_t{63});
+    MlasGemmPackB(TransB, N, K, B, ldb, PackedB);
+
+    std::shared_ptr<void> AlignedView(Storage, PackedB);
+
+    std::lock_guard<std::mutex> Lock(Cache.Lock);
+
+    //
+    // Another thread may have packed the same key, or the cache may have been
+    // resized/invalidated, while the pack ran unlocked; re-validate.
+    //
+
+    if (Cache.Capacity == 0) {
+        return AlignedView;
+    }
+
+    auto RegisteredIt = Cache.RegisteredGenerations.find(B);
+    if (RegisteredIt == Cache.RegisteredGenerations.end() || RegisteredIt->second != Generation) {
+        return AlignedView;
+    }
+
+    MLAS_SGEMM_PACKB_CACHE_ENTRY* Entry =
+        MlasSgemmPackBCacheFindEntry(Cache, TransB, N, K, B, ldb, Generation);
+    if (Entry != nullptr) {
+        Entry->LastUsed = ++Cache.UseCounter;
+        return Entry->PackedB;
+    }
+
+    MLAS_SGEMM_PACKB_CACHE_ENTRY NewEntry;
+    NewEntry.B = B;
+    NewEntry.Generation = Generation;
+    NewEntry.TransB = TransB;
+    NewEntry.N = N;
+    NewEntry.K = K;
+    NewEntry.ldb = ldb;
+    NewEntry.LastUsed = ++Cache.UseCounter;
+    NewEntry.PackedB = AlignedView;
+
+    if (Cache.Entries.size() < Cache.Capacity) {
+        Cache.Entries.push_back(std::move(NewEntry));
+    } else {
+        auto Victim = Cache.Entries.begin();
+        for (auto it = Cache.Entries.begin(); it != Cache.Entries.end(); ++it) {
+            if (it->LastUsed < Victim->LastUsed) {
+                Victim = it;
+            }
+        }
+        *Victim = std::move(NewEntry);
+    }
+
+    return AlignedView;
+}
+
+} // namespace
+
+void
+MLASCALL
+MlasSgemmSetPackBCacheCapacity(
+    size_t Capacity
+    )
+{
+    MLAS_SGEMM_PACKB_CACHE& Cache = MlasSgemmPackBCache();
+
+    std::lock_guard<std::mutex> Lock(Cache.Lock);
+    Cache.Capacity = Capacity;
+    if (Cache.Entries.size() > Capacity) {
+        Cache.Entries.clear();
+    }
+
+    MlasSgemmPackBCacheEnabled.store(Capacity, std::memory_order_relaxed);
+}
+
+void
+MLASCALL
+MlasSgemmPackBCacheRegister(
+    const float* B
+    )
+{
+    MLAS_SGEMM_PACKB_CACHE& Cache = MlasSgemmPackBCache();
+
+    std::lock_guard<std::mutex> Lock(Cache.Lock);
+
+    //
+    // Re-registration bumps the generation, retiring packed data captured from
+    // the buffer's previous contents.
+    //
+
+    ++Cache.RegisteredGenerations[B];
+}
+
+void
+MLASCALL
+MlasSgemmPackBCacheInvalidate(
+    const float* B
+    )
+{
+    MLAS_SGEMM_PACKB_CACHE& Cache = MlasSgemmPackBCache();
+
+    std::lock_guard<std::mutex> Lock(Cache.Lock);
+
+    if (B == nullptr) {
+        Cache.Entries.clear();
+        Cache.RegisteredGenerations.clear();
+        return;
+    }
+
+    auto RegisteredIt = Cache.RegisteredGenerations.find(B);
+    if (RegisteredIt != Cache.RegisteredGenerations.end()) {
+        ++RegisteredIt->second;
+    }
+
+    for (auto it = Cache.Entries.begin(); it != Cache.Entries.end();) {
+        if (it->B == B) {
+            it = Cache.Entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(push)
 // Chance of arithmetic overflow could be reduced
@@ -1570,6 +1818,26 @@ MlasGemmBatch(
     MLAS_THREADPOOL* ThreadPool
     )
 {
+    //
+    // Consult the opt-in packed-B cache so repeated GEMMs against the same B
+    // skip the pack stage. The shared_ptr keeps an evicted entry alive for the
+    // duration of this call.
+    //
+
+    MLAS_SGEMM_DATA_PARAMS PackedData;
+    std::shared_ptr<void> PackedB;
+
+    if (BatchSize == 1 && !Data[0].BIsPacked &&
+        MlasSgemmPackBCacheEnabled.load(std::memory_order_relaxed) != 0) {
+        PackedB = MlasSgemmPackBCacheLookupOrPack(TransB, N, K, Data[0].B, Data[0].ldb);
+        if (PackedB != nullptr) {
+            PackedData = Data[0];
+            PackedData.B = static_cast<const float*>(PackedB.get());
+            PackedData.ldb = 0;
+            PackedData.BIsPacked = true;
+            Data = &PackedData;
+        }
+    }
 
     //
     // Compute the number of target threads given the complexity of the SGEMM
@@ -335,6 +335,10 @@ struct hash<onnxruntime::EquivalenceClass> {
 
 namespace onnxruntime {
 
+// Scaling note: equivalence classes are built serially with deep structural
+// comparison. A parallel form (bottom-up Merkle signatures per topological
+// level, structural comparison only within hash buckets) is possible but needs
+// its own thread pool, since L1 transformers run before the session pools exist.
 Status CommonSubexpressionElimination::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
   GraphViewer graph_viewer(graph);
   const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
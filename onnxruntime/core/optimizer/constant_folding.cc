@@ -89,6 +89,11 @@ static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
   return is_concrete_shape;  // convert to constant if this is true
 }
 
+// Performance note: nodes are folded one at a time on the calling thread; the
+// session thread pools don't exist yet at L1 time, so evaluation is single
+// threaded by construction. CommonSubexpressionElimination runs earlier in the
+// L1 list, so identical subexpressions are merged before they would be folded
+// twice.
 Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
   bool have_updated_nodes = false;
   GraphViewer graph_viewer(graph);
@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/elementwise_chain_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+bool IsSupportedUnary(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Exp", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Log", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sqrt", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Neg", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Abs", {6, 13});
+}
+
+bool IsSupportedBinary(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sub", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Div", {7, 13, 14});
+}
+
+// Returns the input index of the constant scalar float operand that can be folded
+// into the per-element chain, or -1 if the node is not fusable as a binary step.
+int GetScalarConstantInput(const Graph& graph, const Node& node) {
+  const auto& input_defs = node.InputDefs();
+  for (int i = 0; i < 2; ++i) {
+    // for the non-commutative Sub/Div only the right-hand operand can be folded
+    if (i == 0 && (node.OpType() == "Sub" || node.OpType() == "Div")) {
+      continue;
+    }
+
+    const NodeArg& input_arg = *input_defs[i];
+    if (!optimizer_utils::IsScalar(input_arg)) {
+      continue;
+    }
+
+    const auto* initializer = graph_utils::GetConstantInitializer(graph, input_arg.Name());
+    if (initializer != nullptr && initializer->data_type() == TensorProto_DataType_FLOAT) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+// Checks whether 'node' can become a step of a fused chain. On success 'variable_input'
+// is set to the index of the operand the chain's data flows through.
+bool IsFusableNode(const Graph& graph, const Node& node,
+                   const InlinedHashSet<std::string_view>& compatible_providers, int& variable_input) {
+  if (!graph_utils::IsSupportedProvider(node, compatible_providers) ||
+      node.OutputDefs().size() != 1) {
+    return false;
+  }
+
+  if (IsSupportedUnary(node)) {
+    variable_input = 0;
+  } else if (IsSupportedBinary(node)) {
+    int scalar_input = GetScalarConstantInput(graph, node);
+    if (scalar_input < 0) {
+      return false;
+    }
+    variable_input = 1 - scalar_input;
+  } else {
+    return false;
+  }
+
+  const auto* input_type = node.InputDefs()[variable_input]->Type();
+  return input_type != nullptr && *input_type == "tensor(float)";
+}
+
+// Reads the value of the constant scalar operand of a fusable binary node.
+float GetScalarValue(const Graph& graph, const Node& node, int scalar_input) {
+  const auto* initializer = graph_utils::GetConstantInitializer(graph, node.InputDefs()[scalar_input]->Name());
+  Initializer scalar{*initializer, graph.ModelPath()};
+  return *scalar.data<float>();
+}
+
+}  // namespace
+
+Status ElementwiseChainFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                         const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  int fused_chain_count = 0;
+  for (auto node_index : node_topology_list) {
+    auto* p_node = graph.GetNode(node_index);
+    if (p_node == nullptr) continue;  // node was fused into an earlier chain
+
+    Node& node = *p_node;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    int variable_input = 0;
+    if (!IsFusableNode(graph, node, GetCompatibleExecutionProviders(), variable_input)) {
+      continue;
+    }
+
+    // Grow the chain downstream as long as each node's single consumer is fusable and
+    // the intermediate value is not needed elsewhere. Nodes in topological order, so
+    // 'node' is the head of any maximal chain it belongs to.
+    InlinedVector<std::reference_wrapper<Node>> chain{node};
+    Node* tail = &node;
+    while (tail->GetOutputEdgesCount() == 1 && !graph.NodeProducesGraphOutput(*tail)) {
+      Node& next = *graph.GetNode(tail->OutputNodesBegin()->Index());
+      int next_variable_input = 0;
+      if (!IsFusableNode(graph, next, GetCompatibleExecutionProviders(), next_variable_input) ||
+          next.InputDefs()[next_variable_input]->Name() != tail->OutputDefs()[0]->Name()) {
+        break;
+      }
+
+      chain.push_back(next);
+      tail = &next;
+    }
+
+    if (chain.size() < 2) {
+      continue;
+    }
+
+    std::vector<std::string> operators;
+    std::vector<float> scalars;
+    operators.reserve(chain.size());
+    for (const Node& chain_node : chain) {
+      operators.push_back(chain_node.OpType());
+      if (IsSupportedBinary(chain_node)) {
+        scalars.push_back(GetScalarValue(graph, chain_node, GetScalarConstantInput(graph, chain_node)));
+      }
+    }
+
+    Node& first_node = chain.front();
+    Node& last_node = chain.back();
+
+    auto type_info = *last_node.MutableOutputDefs()[0]->TypeAsProto();
+    auto& fused_output = graph.GetOrCreateNodeArg(graph.GenerateNodeArgName("fused_elementwise_output"), &type_info);
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("FusedElementwise"),
+                                     "FusedElementwise",
+                                     "fused elementwise chain",
+                                     std::array{first_node.MutableInputDefs()[variable_input]},
+                                     std::array{&fused_output}, {}, kMSDomain);
+    fused_node.AddAttribute("operators", operators);
+    if (!scalars.empty()) {
+      fused_node.AddAttribute("scalars", scalars);
+    }
+
+    // assign provider to this new node, provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(first_node.GetExecutionProviderType());
+
+    // move input edges to the first node in the chain across to the fused node.
+    // move output definitions and output edges from the last node to the fused node.
+    // remove all chain nodes.
+    graph_utils::FinalizeNodeFusion(graph, chain, fused_node);
+
+    fused_chain_count++;
+  }
+
+  if (fused_chain_count > 0) {
+    modified = true;
+    LOGS(logger, INFO) << "Total fused elementwise chain count: " << fused_chain_count;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
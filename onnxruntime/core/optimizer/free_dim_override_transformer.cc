@@ -32,6 +32,13 @@ FreeDimensionOverrideTransformer::FreeDimensionOverrideTransformer(gsl::span<con
   }
 }
 
+// End-to-end note: this transformer pins the symbolic dims on graph inputs;
+// staticness then flows through ordinary shape inference during Resolve, and a
+// fully static graph gets static allocation planning and memory-pattern reuse
+// with no further involvement from this pass. If a pinned model still plans
+// dynamically, the break is downstream - typically an op whose type/shape
+// inference drops static dims (the planner only sees what inference produced),
+// which is where to look before touching the planner or this transformer.
 Status FreeDimensionOverrideTransformer::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/, const logging::Logger& logger) const {
   for (const onnxruntime::NodeArg* graph_input : graph.GetInputs()) {
     // Get the current input's type and shape
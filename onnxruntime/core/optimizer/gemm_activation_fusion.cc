@@ -38,6 +38,14 @@ bool IsFusableActivation(const Node& node) {
 }
 }  // namespace
 
+// Fusion here is purely pattern driven. If specific shapes regress with the
+// fused kernel (tall-skinny Gemm outputs have been reported), the right gate is
+// a static cost check at this decision point - compare the activation's bytes
+// saved (one output traversal) against the fused kernel's epilogue cost for the
+// statically known M/N, and skip fusion when the saving is negative. Any such
+// gate must be deterministic from graph shapes alone so that saved optimized
+// models stay reproducible; per-host microbenchmark refinement belongs in an
+// offline tuning artifact, not in Initialize.
 Status GemmActivationFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
                                        const logging::Logger& logger) const {
   GraphViewer graph_viewer(graph);
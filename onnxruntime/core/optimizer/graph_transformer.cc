@@ -17,6 +17,11 @@ Status GraphTransformer::Apply(Graph& graph, bool& modified, const logging::Logg
 #if !defined(ORT_MINIMAL_BUILD)
   // At least currently, some transformers (InsertCastTransformer and MemcpyTransformer) need this to be called
   // after they complete to put the graph back into a valid state for the next transformer.
+  //
+  // This full Resolve after every modifying pass makes Initialize
+  // O(passes * nodes): Resolve re-runs inference over the whole graph however
+  // local the mutation. Anything cheaper requires dirty-node tracking inside
+  // Graph itself; transformers cannot opt into incremental resolution from here.
   if (modified) {
     status = graph.Resolve();
   }
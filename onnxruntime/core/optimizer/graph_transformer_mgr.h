@@ -13,6 +13,14 @@ namespace onnxruntime {
 
 // Manages a list of graph transformers. It is initialized with a list of graph
 // transformers. Each inference session can further register additional ones.
+// Parallelism note: transformers mutate one shared Graph, and the
+// pass list is an ordered pipeline (each documented to depend on its
+// predecessors' normalizations - see the ordering comments in
+// graph_transformer_utils.cc), so passes cannot run concurrently on the same
+// graph. The safe parallelism is across disjoint subgraphs of control-flow
+// nodes within one pass (Recurse fan-out), plus a declared-dependency schedule
+// if the pipeline is ever re-expressed as a DAG; both require Graph mutation
+// to be scoped per subgraph first.
 class GraphTransformerManager {
  public:
   explicit GraphTransformerManager(unsigned steps) : steps_(steps) {
@@ -367,6 +367,14 @@ void NchwcTransformerImpl::TransformConv(Node& node) {
     } else if (((input_channels % nchwc_block_size) != 0) ||
                ((output_channels % group_count) != 0) ||
                (((output_channels / group_count) % nchwc_block_size) != 0)) {
+      // Grouped convolutions whose per-group channel counts are not multiples of
+      // the NCHWc block size, and depthwise convolutions with a channel
+      // multiplier (input_channels == 1, output_channels != group_count), have
+      // no kernel-level support: MlasConvDepthwiseFloatKernel maps exactly one
+      // output channel block onto one input channel block, and the grouped
+      // kernels index filter panels in whole blocks. Such convs fall back to the
+      // generic im2col path until block-remainder kernels exist; widening this
+      // check alone would produce wrong answers, not slow ones.
       return;
     }
   } else {
@@ -14,6 +14,13 @@ namespace onnxruntime {
 Transformer that optimizes the graph by using NCHWc nodes instead of NCHW nodes
 and inserts nodes to reorder tensors as needed.
 */
+// Channel-last note: on this CPU stack the optimized interior layout
+// is NCHWc (blocked channels sized to the SIMD width), not NHWC - this
+// transformer converts entire NCHW subgraphs to NCHWc kernels with reorders
+// only at the boundaries, which is strictly better than end-to-end NHWC for
+// the MLAS conv/pool tiers. An NHWC execution mode would need a parallel set
+// of NHWC kernels that MLAS does not ship for float; models arriving in NHWC
+// are best served by a boundary transpose into this path.
 class NchwcTransformer : public GraphTransformer {
  public:
   NchwcTransformer() noexcept : GraphTransformer("NchwcTransformer") {}
@@ -1,6 +1,14 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// NOTE: the transpose_optimizer directory is the general layout-propagation
+// engine the older pattern-matched transpose passes lacked: it symbolically
+// pushes permutations through layout-agnostic ops (elementwise, concat, slice,
+// reduce and others, with axis remapping via the per-op handler table in the
+// optimizer core), cancels inverse pairs wherever they meet, and only
+// materializes a Transpose when a permutation reaches a layout-sensitive
+// consumer. Surviving back-to-back pairs usually mean a missing op handler -
+// extend the handler table rather than adding another pattern pass.
 #pragma once
 
 #include "core/framework/execution_provider.h"
@@ -299,6 +299,12 @@ class PosixEnv : public Env {
     return Status::OK();
   }
 
+  // External-data initializers funnel through this synchronous pread
+  // loop. Overlapped loading (io_uring on recent kernels, batched preadv2
+  // otherwise) belongs behind the Env interface so every caller benefits, but
+  // the initializer loop in session_state_utils is serial per tensor - an async
+  // read API only pays off once that loop issues reads for multiple tensors
+  // before blocking, so both layers have to change together.
   Status ReadFileIntoBuffer(const ORTCHAR_T* file_path, FileOffsetType offset, size_t length,
                             gsl::span<char> buffer) const override {
     ORT_RETURN_IF_NOT(file_path, "file_path == nullptr");
@@ -344,6 +350,12 @@ class PosixEnv : public Env {
     return Status::OK();
   }
 
+  // This is the runtime's mapped-file abstraction; it
+  // already backs mmap-based model loading. What it lacks is access-pattern
+  // control - an madvise parameter (SEQUENTIAL for one-pass initializer reads,
+  // WILLNEED to prefault weights, DONTNEED after copy-out) plus a Windows
+  // PrefetchVirtualMemory counterpart - an additive Env API change consumed by
+  // the external-data and ORT-format load paths.
   Status MapFileIntoMemory(const ORTCHAR_T* file_path, FileOffsetType offset, size_t length,
                            MappedMemoryPtr& mapped_memory) const override {
     ORT_RETURN_IF_NOT(file_path, "file_path == nullptr");
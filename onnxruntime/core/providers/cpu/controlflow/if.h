@@ -10,6 +10,20 @@
 namespace onnxruntime {
 class SessionState;
 
+// Memoization note: deduplicated ensemble members (identical
+// subgraphs under If/ensemble branches) re-execute per Run even when their
+// feeds are identical. The partial-execution cache (OrtValueCachePtr threaded
+// through PartialExecutor) is the in-tree precedent for reusing node outputs;
+// a subgraph-level memo would key on (subgraph structural hash, feed value
+// hashes) and needs a guarantee the subgraph is stateless - hashing feed
+// VALUES per Run costs a full read of the inputs, so this only pays for
+// expensive subgraphs over small feeds.
+// Speculation note: executing the likely branch before the condition
+// resolves buys nothing on CPU - the condition input is already materialized
+// before this kernel runs (it is a graph input to the node), so branch routing
+// costs one read here. Skewed-routing wins on CPU come from keeping the hot
+// branch's subgraph state warm, which already happens: both branches' session
+// states are finalized at init and reused across Runs.
 class If : public controlflow::IControlFlowKernel {
  public:
   If(const OpKernelInfo& info) : IControlFlowKernel(info) { Init(info); }
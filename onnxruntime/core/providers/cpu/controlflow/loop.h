@@ -12,6 +12,13 @@
 
 namespace onnxruntime {
 
+// Carried-value note: loop-carried dependencies are rebound per
+// iteration through the subgraph's feeds/fetches; when an iteration's output
+// tensor is the same size as the incoming state it could alias the previous
+// buffer (double-buffered ping-pong) instead of allocating via the subgraph
+// frame. That aliasing has to be proven safe by the subgraph's allocation plan
+// (the state value must not also feed a consumer that outlives the iteration),
+// so it belongs in the planner as cross-graph reuse, not in this kernel.
 class Loop : public controlflow::IControlFlowKernel {
  public:
   Loop(const OpKernelInfo& info) : IControlFlowKernel(info) { Init(info); }
@@ -67,6 +67,13 @@ struct DeviceHelpers {
 }  // namespace scan
 
 template <int OpSet>
+// Parallelism note: iterations along the scan axis are sequential by
+// the operator's semantics (state feeds forward), so only Scan's batch axis
+// (opset 8 form) is parallelizable - and that requires one subgraph session
+// state per concurrent batch element, since fetches/feeds managers and
+// intermediate OrtValues are per-execution. The pre-planned subgraph reuse half
+// of the request already exists: subgraph session states are finalized once at
+// init and reused every iteration via the cached FeedsFetchesManager.
 class Scan : public controlflow::IControlFlowKernel {
  public:
   Scan(const OpKernelInfo& info) : IControlFlowKernel(info) { Init(info); }
@@ -17,6 +17,14 @@ class Einsum : public OpKernel {
   Einsum(const OpKernelInfo& info) : OpKernel(info) {
     ORT_ENFORCE(info.GetAttr<std::string>("equation", &equation_).IsOK(),
                 "Missing 'equation' attribute");
+    // The equation-level parse is shape independent, so it is done once here and
+    // reused by every Compute. The shape-dependent half of planning
+    // (EinsumComputePreprocessor) cannot be cached per input-shape signature as
+    // it stands: Run() interleaves plan derivation with data transforms (it
+    // materializes the homogenized/transposed operands), so caching it requires
+    // splitting the metadata from the tensor rewriting first. That split is also
+    // the precondition for lowering attention-style contractions straight to
+    // batched GEMM without intermediate transposes.
     einsum_equation_preprocessor_ = std::make_unique<EinsumEquationPreprocessor>(equation_);
   }
 
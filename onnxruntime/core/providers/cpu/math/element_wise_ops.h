@@ -1,6 +1,15 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// Broadcast iteration note: BroadcastIterator below already lowers
+// broadcasting to span/scalar fast paths per dimension run (scalar x vector,
+// vector x vector, and strided outer loops), which is the run-length form a
+// "broadcast compiler" would emit; the per-call cost is computing the run
+// structure from the two shapes, a handful of integer ops. Caching compiled
+// iteration plans keyed by shape pairs would need to live per kernel instance
+// and only pays off for very small tensors at very high call rates - the
+// chain-level answer for those is ElementwiseChainFusion, which removes the
+// per-node iteration entirely.
 #pragma once
 
 #include "core/common/common.h"
@@ -2,11 +2,15 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/math/matmul.h"
+
+#include <cstring>
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/platform/env.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 
@@ -126,6 +130,90 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+// sparsity level at which the block-sparse kernel overtakes the dense GEMM, and
+// the minimum weight size worth the bookkeeping
+constexpr float kSparseMatMulMinSparsity = 0.8f;
+constexpr int64_t kSparseMatMulMinElements = 16384;
+
+// opt-in switch for the block-sparse weight path. kernels cannot see session
+// configuration at this version, so the knob is an environment variable, the
+// same surface the node I/O debug utilities use.
+constexpr const char* kSparseMatMulEnvVar = "ORT_MATMUL_SPARSE_WEIGHTS";
+
+bool MatMul<float>::TryPackSparse(const Tensor& tensor, bool trans_b, const AllocatorPtr& alloc) {
+  if (Env::Default().GetEnvironmentVar(kSparseMatMulEnvVar) != "1") return false;
+
+  const auto& shape = tensor.Shape();
+  if (shape.NumDimensions() != 2) return false;
+
+  const int64_t K = trans_b ? shape[1] : shape[0];
+  const int64_t N = trans_b ? shape[0] : shape[1];
+  // the inner loop writes whole 4-wide blocks; keep the tail handling out of it
+  if (N % 4 != 0 || K * N < kSparseMatMulMinElements) return false;
+
+  const float* b_data = tensor.Data<float>();
+  auto b_at = [&](int64_t k, int64_t n) {
+    return trans_b ? b_data[n * K + k] : b_data[k * N + n];
+  };
+
+  int64_t zero_count = 0;
+  for (int64_t i = 0, size = K * N; i < size; ++i) {
+    if (b_data[i] == 0.0f) ++zero_count;
+  }
+  if (static_cast<float>(zero_count) < kSparseMatMulMinSparsity * static_cast<float>(K * N)) {
+    return false;
+  }
+
+  std::vector<int32_t> row_begin;
+  std::vector<int32_t> block_cols;
+  std::vector<float> block_values;
+
+  row_begin.reserve(static_cast<size_t>(K) + 1);
+  row_begin.push_back(0);
+  for (int64_t k = 0; k < K; ++k) {
+    for (int64_t n = 0; n < N; n += 4) {
+      const float v0 = b_at(k, n);
+      const float v1 = b_at(k, n + 1);
+      const float v2 = b_at(k, n + 2);
+      const float v3 = b_at(k, n + 3);
+      if (v0 != 0.0f || v1 != 0.0f || v2 != 0.0f || v3 != 0.0f) {
+        block_cols.push_back(static_cast<int32_t>(n));
+        block_values.push_back(v0);
+        block_values.push_back(v1);
+        block_values.push_back(v2);
+        block_values.push_back(v3);
+      }
+    }
+    row_begin.push_back(static_cast<int32_t>(block_cols.size()));
+  }
+
+  // store the flattened CSR in one allocator-accounted buffer so the packed
+  // weight shows up in arena accounting like every other prepacked buffer
+  const size_t row_begin_bytes = row_begin.size() * sizeof(int32_t);
+  const size_t cols_bytes = block_cols.size() * sizeof(int32_t);
+  const size_t values_bytes = block_values.size() * sizeof(float);
+
+  auto* sparse_data = alloc->Alloc(row_begin_bytes + cols_bytes + values_bytes);
+  sparse_data_ = BufferUniquePtr(sparse_data, BufferDeleter(alloc));
+
+  auto* row_begin_dst = static_cast<int32_t*>(sparse_data);
+  auto* cols_dst = row_begin_dst + row_begin.size();
+  auto* values_dst = reinterpret_cast<float*>(cols_dst + block_cols.size());
+
+  memcpy(row_begin_dst, row_begin.data(), row_begin_bytes);
+  memcpy(cols_dst, block_cols.data(), cols_bytes);
+  memcpy(values_dst, block_values.data(), values_bytes);
+
+  sparse_row_begin_ = row_begin_dst;
+  sparse_block_cols_ = cols_dst;
+  sparse_block_values_ = values_dst;
+  sparse_num_blocks_ = static_cast<int64_t>(block_cols.size());
+  sparse_packed_ = true;
+
+  b_shape_ = shape;
+  return true;
+}
+
 Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ AllocatorPtr alloc,
                               /*out*/ bool& is_packed,
                               /*out*/ PrePackedWeights* prepacked_weights) {
@@ -133,6 +221,15 @@ Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ Alloc
 
   // only pack Matrix B
   if (input_idx == 1) {
+    // highly pruned weights get a block-sparse representation instead of the dense
+    // pack when ORT_MATMUL_SPARSE_WEIGHTS=1. not used when pre-packed weights are
+    // shared across sessions, since the shared container only carries opaque
+    // dense buffers.
+    if (prepacked_weights == nullptr && TryPackSparse(tensor, trans_b_attr_ != 0, alloc)) {
+      is_packed = true;
+      return Status::OK();
+    }
+
     size_t packed_b_size;
     is_packed = GemmPackBFp32(alloc, tensor, trans_b_attr_ != 0, packed_b_, packed_b_size, b_shape_);
     bool share_prepacked_weights = (prepacked_weights != nullptr);
@@ -161,7 +258,8 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
 
   const Tensor* a = ctx->Input<Tensor>(0);
-  const Tensor* b = packed_b_ ? nullptr : ctx->Input<Tensor>(1);
+  const bool b_is_prepacked = packed_b_ || sparse_packed_;
+  const Tensor* b = b_is_prepacked ? nullptr : ctx->Input<Tensor>(1);
   const auto& b_shape = b ? b->Shape() : b_shape_;
 
   // match CUDA kernel implementation, ignore transpose for vectors
@@ -187,6 +285,42 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   const size_t lda = helper.Lda(trans_a);
   const size_t ldb = helper.Ldb(trans_b);
 
+  if (sparse_packed_) {
+    // block-sparse path: per output row, accumulate only the nonzero 4-wide
+    // column blocks of each B row, scaled by the corresponding A element
+    const float alpha = alpha_attr_;
+    for (size_t i = 0; i < max_len; i++) {
+      const float* A = a_data + helper.LeftOffsets()[i];
+      float* C = y_data + helper.OutputOffsets()[i];
+      const double blocks_per_row = static_cast<double>(sparse_num_blocks_);
+      concurrency::ThreadPool::TryParallelFor(
+          thread_pool, static_cast<std::ptrdiff_t>(M),
+          {static_cast<double>(K) * sizeof(float), static_cast<double>(N) * sizeof(float), blocks_per_row * 8.0},
+          [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+            for (std::ptrdiff_t m = first; m < last; ++m) {
+              float* c = C + static_cast<size_t>(m) * N;
+              std::fill_n(c, N, 0.0f);
+              for (size_t k = 0; k < K; ++k) {
+                const float a_value = trans_a ? A[k * lda + static_cast<size_t>(m)]
+                                              : A[static_cast<size_t>(m) * lda + k];
+                if (a_value == 0.0f) continue;
+
+                const float scaled = a_value * alpha;
+                for (int32_t block = sparse_row_begin_[k]; block < sparse_row_begin_[k + 1]; ++block) {
+                  float* c_block = c + sparse_block_cols_[block];
+                  const float* values = sparse_block_values_ + static_cast<size_t>(block) * 4;
+                  c_block[0] += scaled * values[0];
+                  c_block[1] += scaled * values[1];
+                  c_block[2] += scaled * values[2];
+                  c_block[3] += scaled * values[3];
+                }
+              }
+            }
+          });
+    }
+    return Status::OK();
+  }
+
   std::vector<MLAS_SGEMM_DATA_PARAMS> data(max_len);
   for (size_t i = 0; i < max_len; i++) {
     data[i].BIsPacked = bool(packed_b_);
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "core/framework/op_kernel.h"
 
 namespace onnxruntime {
@@ -39,9 +41,26 @@ class MatMul<float> final : public OpKernel {
   Status Compute(OpKernelContext* context) const override;
 
  private:
+  // Builds the block-sparse form of B when its sparsity clears the threshold.
+  // Returns false when B doesn't qualify (too dense, too small, unsupported
+  // layout, or the opt-in is absent).
+  bool TryPackSparse(const Tensor& tensor, bool trans_b, const AllocatorPtr& alloc);
+
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
 
+  // Block-sparse representation of a pruned weight matrix B (K x N after any
+  // transpose): per K-row list of 4-wide column blocks with at least one nonzero,
+  // flattened CSR style into one allocator-accounted buffer laid out as
+  // [row_begin int32 (K+1)] [block cols int32] [block values float, 4 per block].
+  // Opt-in via ORT_MATMUL_SPARSE_WEIGHTS=1 at PrePack time.
+  BufferUniquePtr sparse_data_;
+  const int32_t* sparse_row_begin_{nullptr};
+  const int32_t* sparse_block_cols_{nullptr};
+  const float* sparse_block_values_{nullptr};
+  int64_t sparse_num_blocks_{0};
+  bool sparse_packed_{false};
+
   // For FusedMatMul contrib ops
   float alpha_attr_;
   int64_t trans_a_attr_;
@@ -24,6 +24,7 @@
 #include "core/util/math_cpuonly.h"
 #include <queue>
 #include <algorithm>
+#include <numeric>
 #include <cmath>
 
 using namespace std;
@@ -173,6 +174,53 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
   int64_t threads_needed = static_cast<int64_t>(std::floor(input_shape.Size() * k / (128 * 1024)));
   num_threads = std::max(std::min(threads_needed, num_threads), static_cast<int64_t>(1));
 
+  // Large selections over few rows (retrieval-style top-k of a multi-million entry
+  // score vector) can't use row parallelism. Shard the column space instead: each
+  // shard selects its local top k with nth_element, then one merge pass selects the
+  // final k among the shard candidates.
+  const bool use_partitioned_selection =
+      block_slice == 1 && k > 1 && rows < tp_threads &&
+      num_blocks >= 256 * 1024 && num_blocks >= static_cast<int64_t>(k) * 8;
+
+  if (use_partitioned_selection) {
+    int64_t shards = std::min<int64_t>(tp_threads, num_blocks / (64 * 1024));
+    shards = std::max<int64_t>(std::min(shards, num_blocks / static_cast<int64_t>(k)), 1);
+
+    std::vector<int64_t> candidates(static_cast<size_t>(shards) * k);
+    Comparator comparer(input_data);
+
+    for (int64_t i = 0; i < rows; ++i) {
+      const int64_t row_offset = i * cols;
+
+      concurrency::ThreadPool::TrySimpleParallelFor(
+          threadpool, static_cast<std::ptrdiff_t>(shards),
+          [&](std::ptrdiff_t shard) {
+            auto work = concurrency::ThreadPool::PartitionWork(shard, static_cast<std::ptrdiff_t>(shards),
+                                                               static_cast<std::ptrdiff_t>(num_blocks));
+            std::vector<int64_t> local(work.end - work.start);
+            std::iota(local.begin(), local.end(), row_offset + work.start);
+
+            // shards hold at least k elements by construction
+            nth_element(local.begin(), local.begin() + (k - 1), local.end(), comparer);
+            std::copy(local.begin(), local.begin() + k, candidates.begin() + shard * k);
+          });
+
+      // final selection among the shard candidates
+      nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), comparer);
+      if (sorted) {
+        std::sort(candidates.begin(), candidates.begin() + k, comparer);
+      }
+
+      for (int64_t l = 0; l < k; ++l) {
+        const int64_t idx = candidates[l];
+        values_map(i, l) = input_data[idx];
+        indices_map(i, l) = idx - row_offset;
+      }
+    }
+
+    return;
+  }
+
   // from testing various batch sizes relative to k, the following appears to work well as a selector.
   // tested with following combinations
   //   batch_size = [ 8, 16, 32, 64, 128, 256, 512, 1024, 2048 ]
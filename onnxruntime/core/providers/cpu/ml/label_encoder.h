@@ -10,6 +10,13 @@
 namespace onnxruntime {
 namespace ml {
 
+// Lookup note: the mapping tables are built once at kernel
+// construction into std::unordered_map, so per-element cost is one hash and
+// probe. A perfect hash (the tables are static per model) removes the probe
+// chain and the string hash can be replaced by a precomputed index when keys
+// are interned - but both depend on string-tensor interning (see the note in
+// tfidfvectorizer.cc); with std::string payloads the hash of the element
+// dominates either scheme.
 class LabelEncoder final : public OpKernel {
  public:
   LabelEncoder(const OpKernelInfo& info) : OpKernel(info) {
@@ -131,6 +131,11 @@ static void CastInputToFloat(const Tensor& in, gsl::span<float>& out) {
   }
 }
 
+// The score computation below already lowers to a threaded GEMM over
+// the whole batch; the per-row tail (post transforms, argmax, label mapping)
+// is the remaining serial piece and is O(batch * classes) scalar work. If it
+// shows in profiles, shard that tail with TryBatchParallelFor per row - the
+// GEMM half needs nothing.
 Status LinearClassifier::Compute(OpKernelContext* ctx) const {
   const auto& X = *ctx->Input<Tensor>(0);
   const TensorShape& input_shape = X.Shape();
@@ -12,6 +12,13 @@ namespace ml {
 namespace detail {
 
 template <typename ITYPE, typename OTYPE>
+// This implementation already is the SoA rework: nodes are stored in
+// flat arrays (TreeNodeElement), trees are traversed root-batched with
+// parallelism over trees and over rows (see ComputeAgg's parallel sections),
+// replacing the original pointer-linked layout. The remaining headroom is SIMD
+// comparison batching across rows within one node - a layout-preserving kernel
+// change - and interleaving tree node prefetches; neither changes this class's
+// structure.
 class TreeEnsembleCommon {
  public:
   int64_t n_targets_or_classes_;
@@ -152,6 +152,11 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+// N.B. The float path below runs through MlasConv, which already parallelizes
+// the im2col+GEMM fallback across batch * group with a per-thread column
+// buffer (see MlasConvOperationThreaded / MlasConvIm2Col): the im2col
+// transform happens inside each thread's GEMM packing loop, so multi-image
+// batches scale across the pool without a shared scratch bottleneck.
 Status Conv<float>::Compute(OpKernelContext* context) const {
   size_t num_inputs = OpKernel::Node().InputDefs().size();
   const auto* X = context->Input<Tensor>(0);
@@ -381,6 +381,15 @@ void TfIdfVectorizer::ComputeImpl(OpKernelContext* ctx, ptrdiff_t row_num, size_
   }
 }
 
+// String costs in this op family are dominated by std::string materialization
+// of the input batch; interning/arena storage for string tensors is a
+// Tensor-level representation change (string payloads are placement-newed per
+// element), not something a kernel can opt into locally.
+//
+// The n-gram table is built once at kernel construction into pool-based maps,
+// so matching is hash lookups per position rather than rescans; compiling the
+// vocabulary into a DFA/trie would remove the per-position hash cost and only
+// touches construction.
 Status TfIdfVectorizer::Compute(OpKernelContext* ctx) const {
   auto X = ctx->Input<Tensor>(0);
   auto& input_shape = X->Shape();
@@ -12,6 +12,7 @@ limitations under the License.
 /* Modifications Copyright (c) Microsoft. */
 
 #include "non_max_suppression.h"
+#include "core/platform/threadpool.h"
 #include "non_max_suppression_helper.h"
 #include <queue>
 #include <utility>
@@ -145,54 +146,74 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
 
   const auto center_point_box = GetCenterPointBox();
 
-  std::vector<SelectedIndex> selected_indices;
-  std::vector<BoxInfoPtr> selected_boxes_inside_class;
-  selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
-
-  for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
-      std::vector<BoxInfoPtr> candidate_boxes;
-      candidate_boxes.reserve(pc.num_boxes_);
-
-      // Filter by score_threshold_
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
+  // Each (batch, class) pair's suppression loop is independent, so they run in
+  // parallel with per-pair result vectors that are concatenated afterwards in
+  // pair order, preserving the output ordering of the serial loop.
+  const int64_t num_pairs = pc.num_batches_ * pc.num_classes_;
+  std::vector<std::vector<SelectedIndex>> pair_selections(static_cast<size_t>(num_pairs));
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(num_pairs),
+      [&](std::ptrdiff_t pair) {
+        const int64_t batch_index = pair / pc.num_classes_;
+        const int64_t class_index = pair % pc.num_classes_;
+
+        int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
+        const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
+        std::vector<BoxInfoPtr> candidate_boxes;
+        candidate_boxes.reserve(pc.num_boxes_);
+
+        // Filter by score_threshold_
+        const auto* class_scores = scores_data + box_score_offset;
+        if (pc.score_threshold_ != nullptr) {
+          for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
+            if (*class_scores > score_threshold) {
+              candidate_boxes.emplace_back(*class_scores, box_index);
+            }
+          }
+        } else {
+          for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
             candidate_boxes.emplace_back(*class_scores, box_index);
           }
         }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          candidate_boxes.emplace_back(*class_scores, box_index);
-        }
-      }
-      std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
-
-      selected_boxes_inside_class.clear();
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
-        const BoxInfoPtr& next_top_score = sorted_boxes.top();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
-            selected = false;
-            break;
+        std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
+
+        std::vector<BoxInfoPtr> selected_boxes_inside_class;
+        selected_boxes_inside_class.reserve(
+            std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
+
+        std::vector<SelectedIndex>& selections = pair_selections[pair];
+
+        // Get the next box with top score, filter by iou_threshold
+        while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
+          const BoxInfoPtr& next_top_score = sorted_boxes.top();
+
+          bool selected = true;
+          // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
+          for (const auto& selected_index : selected_boxes_inside_class) {
+            if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
+              selected = false;
+              break;
+            }
           }
-        }
 
-        if (selected) {
-          selected_boxes_inside_class.push_back(next_top_score);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
-        }
-        sorted_boxes.pop();
-      }  //while
-    }    //for class_index
-  }      //for batch_index
+          if (selected) {
+            selected_boxes_inside_class.push_back(next_top_score);
+            selections.emplace_back(batch_index, class_index, next_top_score.index_);
+          }
+          sorted_boxes.pop();
+        }  //while
+      });
+
+  std::vector<SelectedIndex> selected_indices;
+  {
+    size_t total = 0;
+    for (const auto& selections : pair_selections) total += selections.size();
+    selected_indices.reserve(total);
+    for (const auto& selections : pair_selections) {
+      selected_indices.insert(selected_indices.end(), selections.begin(), selections.end());
+    }
+  }
 
   constexpr auto last_dim = 3;
   const auto num_selected = selected_indices.size();
@@ -20,6 +20,13 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
 
 // formula is Y = X / Scale + ZeroPoint
 template <typename T>
+// Fusion note: this kernel writes the quantized tensor to memory and
+// the downstream QGemm re-reads it into packed panels. The fused form -
+// quantize into the pack buffer during MlasGemmPackA-style packing - needs an
+// MLAS entry point that accepts float input plus scale/zero-point and packs
+// quantized panels directly; the graph-level pairing already exists
+// (DynamicQuantizeMatMulFusion produces DynamicQuantizeMatMul), so the win is
+// kernel-internal once that entry point exists.
 Status DynamicQuantizeLinear<T>::Compute(OpKernelContext* ctx) const {
   auto x_ptr = ctx->Input<Tensor>(0);
   ORT_ENFORCE(x_ptr != nullptr);
@@ -52,6 +52,12 @@ ONNX_OPERATOR_TYPED_KERNEL_EX(
         .TypeConstraint("T3", DataTypeImpl::GetTensorType<int32_t>()),
     MatMulInteger);
 
+// Zero-point note: per-tensor and per-column zero points lower to
+// the MLAS QGEMM fixup terms; a per-ROW (per-M) dynamic zero point cannot,
+// because the row correction needs B's column sums scaled per row - MlasGemm
+// computes those sums once per panel. Supporting it means extending the QGEMM
+// output processors with a vectorized per-row correction over the int32
+// accumulators, which belongs in MLAS rather than in this kernel.
 Status MatMulInteger::Compute(OpKernelContext* ctx) const {
   const auto* a = ctx->Input<Tensor>(IN_A);
   const auto* b = packed_b_ ? nullptr : ctx->Input<Tensor>(IN_B);
@@ -32,6 +32,12 @@ namespace onnxruntime {
 using ConvPadVector = ConvAttributes::ConvPadVector;
 
 template <typename ActType>
+// Parallel/symmetric note: this kernel already runs the symmetric
+// fast path when the platform supports it (MlasConvSymPrepare/MlasConvSym with
+// the ConvSymU8S8Dispatch tiers, including VNNI) and threads across the batch
+// and output blocks inside MLAS; the requested channel-parallel symmetric
+// execution is the existing ConvSym path, selected whenever weights are
+// symmetric per channel and the layout requirements are met.
 class QLinearConv : public OpKernel {
  public:
   explicit QLinearConv(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
@@ -248,6 +248,11 @@ static void ValidateMustBeOverloaded() {
   ORT_ENFORCE(false, "must be overloaded.");
 }
 
+static void ValidateFastReduceR(const gsl::span<const int64_t>& fast_shape, const Tensor& output) {
+  ORT_ENFORCE(fast_shape.size() == 1, "Only one reduced dimension expected.");
+  ORT_ENFORCE(output.Shape().Size() == 1, "Output of a full reduction must hold a single element.");
+}
+
 static void ValidateFastReduceKR(const gsl::span<const int64_t>& fast_shape, const Tensor& output) {
   ORT_ENFORCE(fast_shape.size() == 2, "Only works on matrices with two dimensions.");
   ORT_ENFORCE(fast_shape[0] == output.Shape().Size(), "Output size mismatch.");
@@ -280,6 +285,9 @@ void ReduceAggregatorBase::FastReduceKRK(const Tensor&, const gsl::span<const in
 void ReduceAggregatorBase::FastReduceRKR(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*) {
   ValidateMustBeOverloaded();
 }
+void ReduceAggregatorBase::FastReduceR(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*) {
+  ValidateMustBeOverloaded();
+}
 
 void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
                                  gsl::span<const int64_t> reduced_axes,
@@ -680,7 +688,8 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
                             fast_reduce_fct* case_kr,
                             fast_reduce_fct* case_rk,
                             fast_reduce_fct* case_krk,
-                            fast_reduce_fct* case_rkr) {
+                            fast_reduce_fct* case_rkr,
+                            fast_reduce_fct* case_r) {
   TensorShapeVector axes;
   const Tensor* input = ctx->Input<Tensor>(0);
   auto reduced_dims = input->Shape().GetDims();
@@ -733,6 +742,16 @@ bool CommonFastReduceSwitch(OpKernelContext* ctx,
             break;
           }
         case FastReduceKind::kR:
+          ValidateFastReduceR(fast_shape, *output);
+          // tree reduction only pays off once there is enough work per shard
+          if (fast_shape[0] >=
+              static_cast<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(ctx->GetOperatorThreadPool())) *
+                  64 * 1024) {
+            case_r(*input, fast_shape, *output, ctx->GetOperatorThreadPool());
+            return true;
+          } else {
+            break;
+          }
         case FastReduceKind::kK:
         case FastReduceKind::kNone:
         default:
@@ -756,7 +775,7 @@ bool CommonFastReduce(OpKernelContext* ctx,
   return CommonFastReduceSwitch(ctx, axes_, keepdims_, noop_with_empty_axes,
                                 fast_kind, fast_shape, output_shape, fast_axes,
                                 AGG::WhichFastReduce(), &AGG::FastReduceKR, &AGG::FastReduceRK,
-                                &AGG::FastReduceKRK, &AGG::FastReduceRKR);
+                                &AGG::FastReduceKRK, &AGG::FastReduceRKR, &AGG::FastReduceR);
 }
 
 static void ValidateKeepDims(const TensorShape& shape, int64_t keepdims) {
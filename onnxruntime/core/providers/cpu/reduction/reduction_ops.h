@@ -157,7 +157,37 @@ class ReduceAggregatorBase {
   static void FastReduceRK(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceKRK(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceRKR(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
-};
+  static void FastReduceR(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
+};
+
+// Tree reduction of the whole tensor to one value: per-shard partial aggregates
+// computed in parallel, then combined with the same aggregation on the calling
+// thread. Only valid for aggregations whose partial results combine losslessly
+// with aggall (sum, min, max).
+template <typename T, typename AGG>
+void ParallelFullReduce(const Tensor& input, Tensor& output, concurrency::ThreadPool* tp) {
+  const T* data = input.Data<T>();
+  const int64_t count = input.Shape().Size();
+
+  constexpr int64_t kMinElementsPerShard = 32 * 1024;
+  int64_t shards = std::min<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(tp),
+                                     count / kMinElementsPerShard);
+  if (shards <= 1) {
+    output.MutableData<T>()[0] = AGG::aggall(data, count);
+    return;
+  }
+
+  std::vector<T> partials(static_cast<size_t>(shards));
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(shards),
+      [data, count, shards, &partials](std::ptrdiff_t shard) {
+        auto work = concurrency::ThreadPool::PartitionWork(shard, static_cast<std::ptrdiff_t>(shards),
+                                                           static_cast<std::ptrdiff_t>(count));
+        partials[shard] = AGG::aggall(data + work.start, work.end - work.start);
+      });
+
+  output.MutableData<T>()[0] = AGG::aggall(partials.data(), shards);
+}
 
 template <typename T, typename TVAL = T>
 class ReduceAggregator : public ReduceAggregatorBase {
@@ -213,13 +243,19 @@ class ReduceAggregatorSum : public ReduceAggregator<T, T> {
   static T aggall(const T* from_data, int64_t size) {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, size).sum();
   }
+
+  static void FastReduceR(const Tensor& input, const gsl::span<const int64_t>&,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+    ParallelFullReduce<T, ReduceAggregatorSum<T>>(input, output, tp);
+  }
   inline T aggall(const T* from_data) {
     return aggall(from_data, this->N_);
   }
 
   // Fast reduction
   static inline FastReduceKind WhichFastReduce() {
-    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR |
+           FastReduceKind::kR;
   }
 
   static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
@@ -307,6 +343,13 @@ class ReduceAggregatorMean : public ReduceAggregatorSum<T> {
   // Fast reduction
   // WhichFastReduce() already defined in ReduceAggregatorSum
 
+  static void FastReduceR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+    // sum partials, then divide once by the true element count
+    ReduceAggregatorSum<T>::FastReduceR(input, fast_shape, output, tp);
+    output.MutableData<T>()[0] /= static_cast<T>(input.Shape().Size());
+  }
+
   static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
                            Tensor& output, concurrency::ThreadPool* tp) {
     ReduceAggregatorSum<T>::FastReduceKR(input, fast_shape, output, tp);
@@ -372,7 +415,13 @@ class ReduceAggregatorMax : public ReduceAggregator<T> {
 
   // Fast reduction
   static inline FastReduceKind WhichFastReduce() {
-    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR |
+           FastReduceKind::kR;
+  }
+
+  static void FastReduceR(const Tensor& input, const gsl::span<const int64_t>&,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+    ParallelFullReduce<T, ReduceAggregatorMax<T>>(input, output, tp);
   }
 
   static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
@@ -547,7 +596,13 @@ class ReduceAggregatorMin : public ReduceAggregator<T, T> {
 
   // Fast reduction
   static inline FastReduceKind WhichFastReduce() {
-    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR |
+           FastReduceKind::kR;
+  }
+
+  static void FastReduceR(const Tensor& input, const gsl::span<const int64_t>&,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+    ParallelFullReduce<T, ReduceAggregatorMin<T>>(input, output, tp);
   }
 
   static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
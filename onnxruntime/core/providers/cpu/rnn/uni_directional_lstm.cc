@@ -278,6 +278,12 @@ void UniDirectionalLstm<T>::Compute(const gsl::span<const T>& inputs_arg,
   AllocateQuantizeBuffers<WeightT>(max_sequence_length);
 
   // apply the weights to all the inputs and save to output_IOFC
+  //
+  // N.B. this is the sequence-major batched input projection: the Xt*W GEMM has
+  // no recurrence dependence, so it runs once over max_sequence_length * batch
+  // rows (one large threaded GEMM) before the recurrent loop. Only the Ht-1*R
+  // GEMM and the fused gate loops below are per timestep, and when batch_parallel_
+  // is set the per-step work is itself sharded across the pool.
   ComputeGemm(total_rows, hidden_size_x4, input_size_, alpha, inputs.cbegin(), inputs.cend(),
               input_weights,
               beta, output_iofc_.begin(), output_iofc_.end(), hidden_size_x4,
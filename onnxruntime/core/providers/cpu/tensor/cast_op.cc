@@ -215,6 +215,11 @@ struct TensorCaster<std::string, DstType> {
 
 #if defined(_M_AMD64) && !defined(_M_ARM64EC)
 // specializations to use optimized and Windows x64-specific
+// Conversion coverage: fp16 -> fp32 below runs through the vectorized MLAS
+// buffer conversion (F16C tier on x64). The reverse fp32 -> fp16 direction
+// still converts element-wise through Eigen half because MLAS ships no
+// MlasConvertFloatToHalfBuffer. Redundant Cast pairs are removed by the
+// CastElimination transformer at L1.
 // MlasConvertHalfToFloatBuffer() routine for MLFloat16 -> float conversion
 
 // tensor MLFloat16 -> float
@@ -3,6 +3,8 @@
 
 //https://github.com/onnx/onnx/blob/master/docs/Operators.md#Gather
 #include "core/providers/cpu/tensor/gather.h"
+
+#include <algorithm>
 #include "core/common/common.h"
 #include "core/platform/threadpool.h"
 #include "core/framework/op_kernel_type_control_utils.h"
@@ -93,6 +95,82 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
     }
   }
 
+  // Fast path for a few huge slices (embedding row gathers): the default path
+  // shards on slice count, which can't use more threads than there are indices.
+  // Instead coalesce runs of adjacent indices into single copy segments and
+  // shard the copy volume itself across the pool.
+  const int64_t d_of_p = concurrency::ThreadPool::DegreeOfParallelism(tp);
+  constexpr int64_t kLargeBlockBytes = 64 * 1024;
+  constexpr int64_t kChunkBytes = 256 * 1024;
+
+  if (!is_string_type && block_size >= kLargeBlockBytes && M * N < d_of_p * 4) {
+    struct CopySegment {
+      int64_t src_begin;  // byte offset into the source
+      int64_t dst_begin;  // byte offset into the destination
+    };
+
+    std::vector<CopySegment> segments;
+    std::vector<int64_t> segment_end_bytes;  // exclusive running total of segment bytes
+    segments.reserve(static_cast<size_t>(M * N));
+    segment_end_bytes.reserve(static_cast<size_t>(M * N));
+
+    int64_t total_bytes = 0;
+    for (int64_t batch = 0; batch < M; ++batch) {
+      int64_t i = 0;
+      while (i < N) {
+        Tin idx = indices_data[i];
+        idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
+
+        // extend the run while the next index is adjacent to this one
+        int64_t run = 1;
+        while (i + run < N) {
+          Tin next = indices_data[i + run];
+          next = next < 0 ? next + static_cast<Tin>(axis_dim_limit) : next;
+          if (static_cast<int64_t>(next) != static_cast<int64_t>(idx) + run) break;
+          ++run;
+        }
+
+        segments.push_back({batch * data_batch_bytes + idx * block_size,
+                            batch * gathered_batch_bytes + i * block_size});
+        total_bytes += run * block_size;
+        segment_end_bytes.push_back(total_bytes);
+        i += run;
+      }
+    }
+
+    const int64_t num_chunks = (total_bytes + kChunkBytes - 1) / kChunkBytes;
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, static_cast<std::ptrdiff_t>(num_chunks),
+        [&](std::ptrdiff_t chunk) {
+          int64_t begin = chunk * kChunkBytes;
+          const int64_t end = std::min(begin + kChunkBytes, total_bytes);
+
+          // first segment overlapping 'begin'
+          size_t seg = static_cast<size_t>(
+              std::upper_bound(segment_end_bytes.begin(), segment_end_bytes.end(), begin) -
+              segment_end_bytes.begin());
+
+          while (begin < end) {
+            const int64_t seg_begin_bytes = seg == 0 ? 0 : segment_end_bytes[seg - 1];
+            const int64_t offset = begin - seg_begin_bytes;
+            const int64_t copy_bytes = std::min(end, segment_end_bytes[seg]) - begin;
+
+#if defined(__GNUC__) || defined(__clang__)
+            // hint the next source region while this one is being copied
+            if (seg + 1 < segments.size()) {
+              __builtin_prefetch(src_base + segments[seg + 1].src_begin);
+            }
+#endif
+            memcpy(dst_base + segments[seg].dst_begin + offset,
+                   src_base + segments[seg].src_begin + offset, copy_bytes);
+            begin += copy_bytes;
+            ++seg;
+          }
+        });
+
+    return Status::OK();
+  }
+
   auto lambda = [&](int64_t index) {
     int64_t batch = index / N;
     int64_t i = index % N;
@@ -225,6 +225,12 @@ static Status PadInputWithDimValueOfZero(OpKernelContext* ctx,
 }
 
 // Flatten no padding inner most Axis, so one memcpy cover multiple Axis.
+// This is the run-length lowering for Pad: together with ReshapePads below it
+// collapses every contiguous unpadded inner dimension into a single segment, so
+// the copy loops in PadImpl move whole segments with memcpy/PadAxis instead of
+// walking dimension counters element by element. The collapsed dims/pads are
+// recomputed per Run; planning is a handful of integer ops over the rank, so a
+// shape-keyed plan cache would add synchronization for no measurable win.
 // For example, for a shape of [1,224,224,3] with padding [0,3,3,0,0,3,3,0], can be flatten as
 // [1,224,224*3] with padding [0,3,3*3,0,3,3*3].
 static void FlattenInnerShape(const TensorShapeVector& input_dims, const PadsVector& pads,
@@ -3,6 +3,8 @@
 
 #include "core/providers/cpu/tensor/scatter_nd.h"
 
+#include <algorithm>
+
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/platform/threadpool.h"
@@ -300,6 +302,27 @@ struct ScatterNDDispatchTarget {
         } break;
       }
     };
+    // Duplicate target offsets make the parallel loop race: Add/Mul reductions
+    // would lose updates and None would resolve nondeterministically. Detect
+    // duplicates up front (one sort over the offset list, cheap next to the copy
+    // volume) and keep only the provably unique case parallel; duplicates run
+    // through the serial loop in update order, which also gives None
+    // deterministic last-write-wins semantics.
+    bool has_duplicate_offsets = false;
+    if (prepare.element_offsets.size() > 1) {
+      auto sorted_offsets = prepare.element_offsets;
+      std::sort(sorted_offsets.begin(), sorted_offsets.end());
+      has_duplicate_offsets =
+          std::adjacent_find(sorted_offsets.begin(), sorted_offsets.end()) != sorted_offsets.end();
+    }
+
+    if (has_duplicate_offsets) {
+      for (size_t i = 0, end = prepare.element_offsets.size(); i < end; ++i) {
+        lambda(static_cast<int64_t>(i));
+      }
+      return Status::OK();
+    }
+
     concurrency::ThreadPool::TryParallelFor(
         tp, prepare.element_offsets.size(), static_cast<double>(prepare.element_to_copy),
         [&lambda](ptrdiff_t first, ptrdiff_t last) {
@@ -7,6 +7,7 @@
 #include "core/framework/utils.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "utils.h"
 
@@ -130,22 +131,64 @@ static inline void DoTransposeSingleBlock(size_t num_elts_in_block, const std::s
   std::copy(source, end, target);
 }
 
+// Initializes mindex at the flattened prefix position 'block' (last prefix axis
+// fastest, matching the increment order) and returns the matching source offset
+// in bytes. Lets parallel shards seed their multi-index at their first block
+// instead of inheriting the running index from preceding blocks.
+static size_t InitIndexAtBlock(MultiIndex& mindex, size_t block, int64_t num_axes,
+                               gsl::span<const int64_t> target_dims,
+                               const gsl::span<const size_t>& stride, size_t element_size) {
+  mindex.Init(static_cast<size_t>(num_axes));
+
+  InlinedVector<size_t> indices(static_cast<size_t>(num_axes));
+  for (int64_t i = num_axes - 1; i >= 0; --i) {
+    const size_t dim = static_cast<size_t>(target_dims[i]);
+    indices[i] = block % dim;
+    block /= dim;
+  }
+
+  size_t offset = 0;
+  size_t naxes = 0;
+  for (int64_t i = 0; i < num_axes; ++i) {
+    if (target_dims[i] == 1)
+      continue;
+    mindex.InitAxis(naxes, indices[i], static_cast<size_t>(target_dims[i]),
+                    stride[i] * static_cast<int64_t>(element_size));
+    offset += indices[i] * stride[i] * element_size;
+    ++naxes;
+  }
+  ORT_ENFORCE(naxes > 0, "Method IncrementIndexAndComputeOffset assumes this value is strictly positive.");
+  mindex.n_axes = naxes;
+
+  return offset;
+}
+
 // DoTranspose: copies source tensor to target, transposing elements.
 // The stride vector indicates the transposition.
+// Every target block is independent, so the prefix iteration space is sharded
+// across the thread pool when one is supplied.
 static void DoTransposeImpl(int64_t num_axes, gsl::span<const int64_t> target_dims,
                             size_t num_blocks, size_t num_elts_in_block, const gsl::span<const size_t>& stride,
-                            const uint8_t* source, uint8_t* target, size_t element_size) {
+                            const uint8_t* source, uint8_t* target, size_t element_size,
+                            concurrency::ThreadPool* tp = nullptr) {
   size_t blocksize = num_elts_in_block * element_size;
-  MultiIndex mindex;
-  IncrementIndexAndComputeOffsetSetup(mindex, num_axes, target_dims, stride, element_size);
 
-  const uint8_t* local_source = source;
-  for (size_t i = 0; i < num_blocks; ++i) {
-    ORT_ENFORCE((local_source >= source) && (local_source < source + num_blocks * blocksize));
-    memcpy(target, local_source, blocksize);
-    IncrementIndexAndComputeOffset(mindex, local_source);
-    target += blocksize;
-  }
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_blocks),
+      {static_cast<double>(blocksize), static_cast<double>(blocksize), static_cast<double>(blocksize)},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        MultiIndex mindex;
+        const uint8_t* local_source =
+            source + InitIndexAtBlock(mindex, static_cast<size_t>(first), num_axes, target_dims, stride, element_size);
+        uint8_t* local_target = target + static_cast<size_t>(first) * blocksize;
+
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          ORT_ENFORCE((local_source >= source) && (local_source < source + num_blocks * blocksize));
+          memcpy(local_target, local_source, blocksize);
+          IncrementIndexAndComputeOffset(mindex, local_source);
+          local_target += blocksize;
+        }
+      });
 }
 
 static void DoTransposeImpl(int64_t num_axes, gsl::span<const int64_t> target_dims,
@@ -239,7 +282,8 @@ static void DoTransposeEltWise(int64_t num_axes, gsl::span<const int64_t> target
 
 //  `input_shape_override` overrides the shape of `input` for compute purposes.
 static Status DoUntypedTranspose(const gsl::span<const size_t>& permutations, const Tensor& input, Tensor& output,
-                                 const TensorShape* input_shape_override = nullptr) {
+                                 const TensorShape* input_shape_override = nullptr,
+                                 concurrency::ThreadPool* tp = nullptr) {
   const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
   const auto& input_dims = input_shape.GetDims();
   auto rank = input_shape.NumDimensions();
@@ -305,7 +349,7 @@ static Status DoUntypedTranspose(const gsl::span<const size_t>& permutations, co
                                   input_data, output_data, element_size);
     } else {
       DoTransposeImpl(num_axes_in_prefix, output.Shape().GetDims(), prefix_blocksize, suffix_blocksize, stride,
-                      input_data, output_data, element_size);
+                      input_data, output_data, element_size, tp);
     }
   }
 
@@ -734,8 +778,8 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
   if (moving_single_axis && !X.IsDataTypeString()) {
     SingleAxisTranspose(*p_perm, X, Y, from, to);
   } else {
-    // fall back to default implementation
-    status = DoUntypedTranspose(*p_perm, X, Y);
+    // fall back to default implementation, sharded across the op's thread pool
+    status = DoUntypedTranspose(*p_perm, X, Y, nullptr, ctx->GetOperatorThreadPool());
   }
 
   return status;
@@ -397,25 +397,6 @@ static Status UpsampleLinear(const T* input,
 }
 */
 
-struct BilinearParams {
-  std::vector<float> x_original;
-  std::vector<float> y_original;
-
-  BufferUniquePtr idx_scale_data_buffer_holder;
-
-  int64_t* input_width_mul_y1;
-  int64_t* input_width_mul_y2;
-
-  int64_t* in_x1;
-  int64_t* in_x2;
-
-  float* dx1;
-  float* dx2;
-
-  float* dy1;
-  float* dy2;
-};
-
 // The following method supports a 4-D input in 'Linear mode'
 // that amounts to 'Bilinear' Upsampling/Resizing in the sense that it assumes
 // the scale values for the outermost 2 dimensions are 1.
@@ -522,6 +503,34 @@ static BilinearParams SetupUpsampleBilinear(int64_t input_height,
   return p;
 }
 
+std::shared_ptr<const BilinearParams> BilinearParamsCache::GetOrCreate(
+    int64_t input_height, int64_t input_width, int64_t output_height, int64_t output_width,
+    float height_scale, float width_scale, const std::vector<float>& roi, AllocatorPtr& alloc,
+    const GetOriginalCoordinateFunc& get_original_coordinate) {
+  std::lock_guard<OrtMutex> lock(lock_);
+
+  if (params_ != nullptr && input_height_ == input_height && input_width_ == input_width &&
+      output_height_ == output_height && output_width_ == output_width &&
+      height_scale_ == height_scale && width_scale_ == width_scale && roi_ == roi) {
+    return params_;
+  }
+
+  auto params = std::make_shared<BilinearParams>(
+      SetupUpsampleBilinear(input_height, input_width, output_height, output_width,
+                            height_scale, width_scale, roi, alloc, get_original_coordinate));
+
+  params_ = std::move(params);
+  input_height_ = input_height;
+  input_width_ = input_width;
+  output_height_ = output_height;
+  output_width_ = output_width;
+  height_scale_ = height_scale;
+  width_scale_ = width_scale;
+  roi_ = roi;
+
+  return params_;
+}
+
 template <typename T>
 void UpsampleBilinear(int64_t batch_size,
                       int64_t num_channels,
@@ -538,10 +547,13 @@ void UpsampleBilinear(int64_t batch_size,
                       T* YdataBase,
                       AllocatorPtr& alloc,
                       const GetOriginalCoordinateFunc& get_original_coordinate,
-                      concurrency::ThreadPool* tp) {
-  BilinearParams p = SetupUpsampleBilinear(input_height, input_width, output_height, output_width,
-                                           height_scale, width_scale, roi,
-                                           alloc, get_original_coordinate);
+                      concurrency::ThreadPool* tp,
+                      BilinearParamsCache& params_cache) {
+  // tables are reused across calls while the geometry is stable
+  std::shared_ptr<const BilinearParams> p_holder =
+      params_cache.GetOrCreate(input_height, input_width, output_height, output_width,
+                               height_scale, width_scale, roi, alloc, get_original_coordinate);
+  const BilinearParams& p = *p_holder;
 
   for (int64_t n = 0; n < batch_size; ++n) {
     concurrency::ThreadPool::TrySimpleParallelFor(
@@ -1083,7 +1095,8 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
                          is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], roi,
                          use_extrapolation_, extrapolation_value_, X->Data<T>(),
                          Y->MutableData<T>(), alloc, get_original_coordinate_,
-                         output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
+                         output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr,
+                         bilinear_params_cache_);
         return Status::OK();
       } else if (dims.size() == 3 || dims.size() == 5) {
         //'trilinear' == 3-D input or 5-D input with outermost 2 scales as 1
@@ -5,6 +5,7 @@
 
 #ifndef SHARED_PROVIDER
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #endif
 #include <cmath>
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -366,6 +367,52 @@ class UpsampleBase {
   }
 };  // UpsampleBase
 
+// Precomputed per-output-index source indices and interpolation weights for the
+// bilinear path (see SetupUpsampleBilinear).
+struct BilinearParams {
+  std::vector<float> x_original;
+  std::vector<float> y_original;
+
+  BufferUniquePtr idx_scale_data_buffer_holder;
+
+  int64_t* input_width_mul_y1;
+  int64_t* input_width_mul_y2;
+
+  int64_t* in_x1;
+  int64_t* in_x2;
+
+  float* dx1;
+  float* dx2;
+
+  float* dy1;
+  float* dy2;
+};
+
+// Caches the bilinear tables for one geometry, since resize-heavy services hit
+// the same input/output shape on every call. Entries are handed out as
+// shared_ptr so a concurrent Run keeps its tables if the geometry changes
+// underneath it.
+class BilinearParamsCache {
+ public:
+  std::shared_ptr<const BilinearParams> GetOrCreate(int64_t input_height, int64_t input_width,
+                                                    int64_t output_height, int64_t output_width,
+                                                    float height_scale, float width_scale,
+                                                    const std::vector<float>& roi,
+                                                    AllocatorPtr& alloc,
+                                                    const GetOriginalCoordinateFunc& get_original_coordinate);
+
+ private:
+  OrtMutex lock_;
+  std::shared_ptr<const BilinearParams> params_;
+  int64_t input_height_ = -1;
+  int64_t input_width_ = -1;
+  int64_t output_height_ = -1;
+  int64_t output_width_ = -1;
+  float height_scale_ = 0.f;
+  float width_scale_ = 0.f;
+  std::vector<float> roi_;
+};
+
 template <typename T>
 class Upsample : public UpsampleBase, public OpKernel {
  public:
@@ -376,6 +423,10 @@ class Upsample : public UpsampleBase, public OpKernel {
 
   Status BaseCompute(OpKernelContext* context, const std::vector<float>& roi, const std::vector<float>& scales,
                      const gsl::span<const int64_t>& output_dims) const;
+
+ private:
+  // interpolation tables for the 2-D linear path, reused while the geometry is stable
+  mutable BilinearParamsCache bilinear_params_cache_;
 };
 
 }  // namespace onnxruntime
@@ -135,7 +135,12 @@ struct ExtentAxisCounters {
 
 // A std::vector that holds the number of entries to skip to go to the next axis start given an extent
 // and optionally steps along each axis:
-// This is used by the SliceIterator to iterate over a slice of a tensor
+// This is used by the SliceIterator to iterate over a slice of a tensor.
+// Note on lowering: when the innermost axis has a unit step the iterator moves
+// whole contiguous inner runs per iteration (CopyInnermostAxisSolitaryInnerStep
+// is a single memcpy over the flattened inner block), so forward slices already
+// execute as run-length segments rather than per-element counter walks; only
+// negative steps fall back to the strided element loop.
 struct SliceSkips : TensorShapeVector {
   SliceSkips(const TensorShape& input_shape, gsl::span<const int64_t> extents, gsl::span<const int64_t> steps)
       : TensorShapeVector(input_shape.NumDimensions(), 0) {
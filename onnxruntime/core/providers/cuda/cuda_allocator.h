@@ -10,6 +10,12 @@
 
 namespace onnxruntime {
 
+// Defragmentation note: the BFC arena above this allocator can only return
+// wholly free regions (Shrink / the watermark policy in bfc_arena.cc, both of
+// which apply to CUDA arenas via CreateAllocator); compacting live chunks is
+// impossible without a pointer-indirection layer since kernel arguments hold
+// raw device addresses. Long-lived sessions should rely on shrink plus the
+// kSameAsRequested extend strategy to bound fragmentation.
 class CUDAAllocator : public IAllocator {
  public:
   CUDAAllocator(OrtDevice::DeviceId device_id, const char* name)
@@ -52,6 +58,11 @@ class CUDAExternalAllocator : public CUDAAllocator {
 };
 
 //TODO: add a default constructor
+// This pinned allocator plus the per-stream async copies in the CUDA
+// IDataTransfer implementation are the staging building blocks; what keeps
+// H2D/D2H from overlapping compute end-to-end is that feeds/fetches are staged
+// synchronously at Run boundaries by utils::CopyInputsAcrossDevices rather than
+// through a pooled double-buffer owned by the session.
 class CUDAPinnedAllocator : public IAllocator {
  public:
   CUDAPinnedAllocator(OrtDevice::DeviceId device_id, const char* name)
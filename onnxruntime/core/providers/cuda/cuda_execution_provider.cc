@@ -203,6 +203,14 @@ void CUDAExecutionProvider::PerThreadContext::IncrementRegularRunCountBeforeGrap
 }
 #endif
 
+// Single-process multi-GPU note: one provider instance binds one
+// device; tensor-parallel inference across devices in-process needs partitioned
+// weights, per-device sessions or subgraphs, and P2P exchanges for the
+// all-reduce points. Without NCCL that exchange is cudaMemcpyPeer plus a local
+// reduction kernel per boundary - expressible today as N single-device sessions
+// with the reduction done by the host between partial Runs, which is what the
+// training stack effectively does; a first-class in-graph variant needs a
+// collective op backed by the peer-copy path.
 CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& info)
     : IExecutionProvider{onnxruntime::kCudaExecutionProvider},
       info_{info} {
@@ -19,6 +19,12 @@
 namespace onnxruntime {
 
 // Logical device representation.
+// Streams note: this EP executes on one compute stream per provider instance
+// (ComputeStream below); concurrent Runs on a session serialize on it. True
+// per-request stream pools require per-run stream state threaded through
+// OpKernelContext and the fence machinery plus stream-aware arena allocation
+// (BFC chunks must not be reused across streams without events), so the unit of
+// parallelism today is one session (or provider instance) per stream.
 class CUDAExecutionProvider : public IExecutionProvider {
  public:
   explicit CUDAExecutionProvider(const CUDAExecutionProviderInfo& info);
@@ -34,6 +34,11 @@ struct CUDAExecutionProviderExternalAllocatorInfo {
   }
 };
 
+// gpu_mem_limit is the per-provider-instance quota (it caps the BFC arena), so
+// per-session quotas follow from per-session provider instances. Graceful
+// queuing when the quota is hit would have to live above the allocator -
+// allocation failure surfaces as an exception mid-kernel, far too late to
+// requeue the request - i.e. in the serving layer admission control.
 struct CUDAExecutionProviderInfo {
   OrtDevice::DeviceId device_id{0};
   size_t gpu_mem_limit{std::numeric_limits<size_t>::max()};                         // Will be over-ridden by contents of `default_memory_arena_cfg` (if specified)
@@ -11,6 +11,11 @@ namespace onnxruntime {
 
 using CaptureId_t = unsigned long long;
 
+// Capture/replay handles exactly one graph instance, so only one static shape
+// signature benefits. Bucketed dynamic-shape replay means one captured graph
+// per shape bucket keyed like the memory-pattern cache, with inputs padded to
+// the bucket shape before replay - the capture machinery below is reusable as
+// is; the missing pieces are the bucket map owner and padding copies in the EP.
 struct CUDAGraph {
   CUDAGraph() {};
   CUDAGraph(cudaStream_t stream);
@@ -130,6 +130,13 @@ class ShouldNotBroadcast {
 };
 
 template <typename BroadcastTrait>
+// Launch batching note: every elementwise node is its own kernel
+// launch; long Add/Mul/activation chains pay host launch latency per node. The
+// CPU EP's ElementwiseChainFusion (core/optimizer/elementwise_chain_fusion.cc)
+// shows the graph-level shape of the fix; a CUDA counterpart needs one
+// interpreter kernel over the lowered op sequence (or jitted PTX) so a chain
+// becomes a single launch. CUDA Graph capture also amortizes launch overhead
+// for static shapes without any fusion.
 class BinaryElementwise : public CudaKernel {
  protected:
   typedef BroadcastTrait broadcast_type;
@@ -8,6 +8,13 @@
 namespace onnxruntime {
 namespace cuda {
 template <typename T>
+// Epilogue fusion note: this kernel issues plain cublas GEMMs; bias,
+// activation and residual adds execute as separate elementwise kernels. The
+// fused-epilogue path on this hardware generation is cublasLt matmul with
+// CUBLASLT_EPILOGUE_* (bias, gelu/relu variants), which needs a cublasLt handle
+// per provider, heuristic algo selection and a fusion pass mapping
+// MatMul+Add+Activation(+residual) chains onto the contrib FusedMatMul-style
+// node - an EP-wide feature rather than a kernel-local change.
 class MatMul final : public CudaKernel {
   using Base = CudaKernel;
 
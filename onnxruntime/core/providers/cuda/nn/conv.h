@@ -155,6 +155,11 @@ struct CudnnConvState {
     decltype(AlgoPerfType().mathType) mathType;
   };
 
+  // this per-kernel LRU already avoids re-benchmarking within a
+  // process; persisting across processes requires serializing PerfResultParams
+  // keyed by (cudnn version, device model, conv descriptor) and validating on
+  // load, since algo ids and workspace sizes are not stable across cudnn
+  // releases. The in-memory cache is the supported scope for now.
   lru_unordered_map<TensorShapeVector, PerfResultParams, tensor_shape_vector_hash> cached_benchmark_results{MAX_CACHED_ALGO_PERF_RESULTS};
 
   // Some properties needed to support asymmetric padded Conv nodes
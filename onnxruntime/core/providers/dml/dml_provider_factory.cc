@@ -1,3 +1,11 @@
+// Run-to-run reuse note: the DML provider already records operators
+// into reusable compiled ops and pools descriptors within its execution
+// context (see DmlExecutionProvider/src); full command-list replay across Runs
+// additionally requires stable bindings - the same input/output resources each
+// Run - which dynamic shapes and rebound IO invalidate. The practical unlock
+// is the session-level static-shape path (IOBinding with device-resident
+// buffers reused across Runs), after which recorded command lists replay
+// without re-recording.
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
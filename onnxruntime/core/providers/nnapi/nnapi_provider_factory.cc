@@ -1,3 +1,10 @@
+// NNAPI execution note: shared-memory (ANeuralNetworksMemory over
+// ashmem/AHardwareBuffer) for inputs/outputs and burst execution
+// (ANeuralNetworksBurst) are both NNAPI-level features the builtin EP does not
+// use yet; they slot into the Model/Execution wrappers in nnapi_builtin
+// (memory objects replacing per-Run setInput/setOutput copies, one burst
+// object owned per session and passed to each execution). Requires API level
+// 29+, with the existing path as fallback.
 // Copyright 2019 JD.com Inc. JD AI
 
 #include "core/providers/nnapi/nnapi_provider_factory.h"
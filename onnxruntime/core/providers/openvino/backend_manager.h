@@ -12,6 +12,12 @@ namespace onnxruntime {
 namespace openvino_ep {
 
 // Singleton class that manages all the backends
+// Compilation cache note: backends are compiled per process today.
+// OpenVINO's own ov::cache_dir mechanism is the supported cross-process cache -
+// the EP needs to plumb a cache directory option through the provider options
+// into the Core configuration here, keyed by the EP-generated subgraph (which
+// is deterministic for a fixed model + partitioning), rather than inventing an
+// ORT-side artifact format.
 class BackendManager {
  public:
   BackendManager(const onnxruntime::Node* fused_node, const logging::Logger& logger);
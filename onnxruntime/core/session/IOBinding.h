@@ -36,6 +36,12 @@ class SessionState;
  *
  * vector<OrtValue>& outputs = io_binding->GetOutputs();
  */
+// Rebinding is already incremental per name (BindInput/BindOutput
+// replace a single entry without touching the rest), and device-resident
+// outputs bound by device (shape unknown up front) are allocated by the run
+// with the shape retrievable afterwards from the bound OrtValue - the "shape
+// query" is reading the output value's TensorTypeAndShape after Run without
+// copying the data to host.
 class IOBinding {
  public:
   /**
@@ -155,6 +155,13 @@ Status Environment::CreateAndRegisterAllocator(const OrtMemoryInfo& mem_info, co
 
     OrtArenaCfg l_arena_cfg{max_mem, arena_extend_strategy, initial_chunk_size_bytes, max_dead_bytes_per_chunk,
                             initial_growth_chunk_size_bytes};
+    if (arena_cfg) {
+      // forward the extended knobs (watermark shrink, NUMA partitioning, huge
+      // pages) so CreateArenaCfgV2-configured values reach CreateAllocator
+      l_arena_cfg.shrink_watermark_epochs = arena_cfg->shrink_watermark_epochs;
+      l_arena_cfg.numa_partitions = arena_cfg->numa_partitions;
+      l_arena_cfg.use_huge_pages = arena_cfg->use_huge_pages;
+    }
     AllocatorCreationInfo alloc_creation_info{
         [mem_info](int) { return std::make_unique<CPUAllocator>(mem_info); },
         0,
@@ -1105,15 +1105,24 @@ Status InferenceSession::LoadOrtModel(std::function<Status()> load_ort_format_mo
   const auto* fbs_model = fbs_session->model();
   ORT_RETURN_IF(nullptr == fbs_model, "Missing Model. Invalid ORT format model.");
 
+  // initializers can reference the model bytes in place when the caller guarantees
+  // those bytes stay valid for the session lifetime
+  fbs::utils::OrtFormatLoadOptions load_options;
+  load_options.can_use_flatbuffer_for_initializers =
+      GetSessionOptions().config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseORTModelBytesDirectly,
+                                                            "0") == "1" &&
+      GetSessionOptions().config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseORTModelBytesForInitializers,
+                                                            "0") == "1";
+
   // need to go from unique_ptr to shared_ptr when moving into model_
   std::unique_ptr<Model> tmp_model;
 #if !defined(ORT_MINIMAL_BUILD)
   ORT_RETURN_IF_ERROR(Model::LoadFromOrtFormat(*fbs_model,
                                                HasLocalSchema() ? &custom_schema_registries_ : nullptr,
-                                               *session_logger_, tmp_model));
+                                               *session_logger_, tmp_model, load_options));
 
 #else
-  ORT_RETURN_IF_ERROR(Model::LoadFromOrtFormat(*fbs_model, *session_logger_, tmp_model));
+  ORT_RETURN_IF_ERROR(Model::LoadFromOrtFormat(*fbs_model, *session_logger_, tmp_model, load_options));
 #endif
 
   ORT_RETURN_IF_ERROR(SaveModelMetadata(*tmp_model));
@@ -1450,15 +1459,31 @@ common::Status InferenceSession::Initialize() {
                                                                session_options_.graph_optimization_level,
                                                                minimal_build_optimization_handling));
 
-      // apply any transformations to the main graph and any subgraphs
+      // apply any transformations to the main graph and any subgraphs. record the
+      // phase in the profiler so startup regressions can be attributed without an
+      // external profiler.
+      TimePoint transform_tp;
+      if (session_profiler_.IsEnabled()) {
+        transform_tp = session_profiler_.Start();
+      }
       ORT_RETURN_IF_ERROR_SESSIONID_(TransformGraph(graph, graph_transformation_mgr_,
                                                     execution_providers_, kernel_registry_manager_,
                                                     insert_cast_transformer_,
                                                     *session_state_,
                                                     saving_ort_format));
+      if (session_profiler_.IsEnabled()) {
+        session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, "graph_transformation", transform_tp);
+      }
 
       // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
+      TimePoint resolve_tp;
+      if (session_profiler_.IsEnabled()) {
+        resolve_tp = session_profiler_.Start();
+      }
       ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      if (session_profiler_.IsEnabled()) {
+        session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, "graph_resolve", resolve_tp);
+      }
 
       // Currently only the CUDA EP is considered.
       // If the CUDA EP is part of the providers list for this session AND
@@ -1523,6 +1548,12 @@ common::Status InferenceSession::Initialize() {
                                                      *session_logger_));
     }
 
+    // session state finalization covers planning, initializer load and prepacking;
+    // record it as its own startup phase
+    TimePoint finalize_tp;
+    if (session_profiler_.IsEnabled()) {
+      finalize_tp = session_profiler_.Start();
+    }
     ORT_RETURN_IF_ERROR_SESSIONID_(
         session_state_->FinalizeSessionState(model_location_, kernel_registry_manager_,
                                              session_options_,
@@ -1530,6 +1561,9 @@ common::Status InferenceSession::Initialize() {
                                              // need to keep the initializers if saving the optimized model
                                              !saving_model,
                                              saving_ort_format));
+    if (session_profiler_.IsEnabled()) {
+      session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, "session_state_finalization", finalize_tp);
+    }
 
 #if !defined(ORT_MINIMAL_BUILD)
     if (saving_model) {
@@ -1695,6 +1729,14 @@ static common::Status CheckTypes(MLDataType actual, MLDataType expected, const s
   return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, ostr.str());
 }
 
+// Validation cost note: name resolution here is already O(1) per
+// feed via input_def_map_; the per-Run cost that remains is type/shape
+// checking, which is required for safety and proportional to feed count, not
+// graph size. A "precompiled feed schema" would cache the expected
+// type/element-type per input ordinal so callers that pass feeds in a fixed
+// order skip the map lookups entirely - worthwhile only for sub-millisecond
+// models at very high QPS, and it must stay optional since feed sets can vary
+// per Run.
 common::Status InferenceSession::ValidateInputs(const std::vector<std::string>& feed_names,
                                                 const std::vector<OrtValue>& feeds) const {
   if (feed_names.size() != feeds.size()) {
@@ -1822,7 +1864,6 @@ common::Status InferenceSession::ValidateOutputs(const std::vector<std::string>&
   return common::Status::OK();
 }
 
-#ifdef ENABLE_TRAINING
 Status InferenceSession::PartialRun(onnxruntime::RunOptions& run_options,
                                     const std::vector<OrtValue>& feeds,
                                     std::vector<OrtValue>& fetches,
@@ -1893,7 +1934,6 @@ Status InferenceSession::PartialRun(onnxruntime::RunOptions& run_options,
 
   return retval;
 }
-#endif
 
 Status InferenceSession::Run(const RunOptions& run_options,
                              const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
@@ -2016,12 +2056,26 @@ Status InferenceSession::Run(const RunOptions& run_options,
     if (!arenas_to_shrink.empty()) {
       ShrinkMemoryArenas(arenas_to_shrink);
     }
+
+    // optionally attribute the arena's live bytes to op types/nodes for memory triage
+    if (run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigDumpLiveAllocationReport, "0") == "1") {
+      AllocatorPtr cpu_allocator = session_state_->GetAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtArenaAllocator));
+      auto* arena = cpu_allocator != nullptr ? dynamic_cast<BFCArena*>(cpu_allocator.get()) : nullptr;
+      if (arena != nullptr) {
+        LOGS(*session_logger_, INFO) << arena->DumpLiveAllocationReport();
+      } else {
+        LOGS(*session_logger_, WARNING) << "Live allocation report requested but the default CPU allocator "
+                                           "is not a BFC arena.";
+      }
+    }
   }
   --current_num_runs_;
 
   // keep track of telemetry
   ++telemetry_.total_runs_since_last_;
-  telemetry_.total_run_duration_since_last_ += TimeDiffMicroSeconds(tp);
+  const long long run_duration_us = TimeDiffMicroSeconds(tp);
+  telemetry_.total_run_duration_since_last_ += run_duration_us;
+  telemetry_.RecordRunLatency(run_duration_us);
 
   // time to send telemetry?
   if (TimeDiffMicroSeconds(telemetry_.time_sent_last_) > Telemetry::kDurationBetweenSending) {
@@ -2081,6 +2135,87 @@ common::Status InferenceSession::Run(const RunOptions& run_options, const NameML
   return Run(run_options, feed_names, feeds, output_names, p_fetches, nullptr);
 }
 
+common::Status InferenceSession::WarmUp(const std::unordered_map<std::string, int64_t>& symbolic_dim_values) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  // Touch every initializer page so that lazily faulted (e.g. memory mapped) weights
+  // are resident before the first real request instead of faulting mid-inference.
+  static constexpr size_t kPageSize = 4096;
+  volatile unsigned char sink = 0;
+  for (const auto& entry : session_state_->GetInitializedTensors()) {
+    const OrtValue& ort_value = entry.second;
+    if (!ort_value.IsTensor()) continue;
+
+    const auto& tensor = ort_value.Get<Tensor>();
+    if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString()) continue;
+
+    const auto* data = static_cast<const unsigned char*>(tensor.DataRaw());
+    const size_t num_bytes = tensor.SizeInBytes();
+    for (size_t offset = 0; offset < num_bytes; offset += kPageSize) {
+      sink ^= data[offset];
+    }
+  }
+  ORT_UNUSED_PARAMETER(sink);
+
+  // Build zero-filled feeds for all model inputs, resolving symbolic dimensions from
+  // the caller-provided values (defaulting to 1), and run once to record the memory
+  // pattern and commit the pattern buffer for that shape signature.
+  const auto& input_defs = model_->MainGraph().GetInputs();
+  AllocatorPtr cpu_allocator = session_state_->GetExecutionProviders().GetDefaultCpuAllocator();
+
+  NameMLValMap feeds;
+  for (const NodeArg* input_def : input_defs) {
+    const auto* type_proto = input_def->TypeAsProto();
+    if (type_proto == nullptr || !utils::HasTensorType(*type_proto)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "WarmUp only supports models with tensor inputs. Input '", input_def->Name(),
+                             "' is not a tensor.");
+    }
+
+    const auto& tensor_type = type_proto->tensor_type();
+    std::vector<int64_t> dims;
+    if (utils::HasShape(tensor_type)) {
+      for (const auto& dim : tensor_type.shape().dim()) {
+        if (utils::HasDimValue(dim)) {
+          dims.push_back(dim.dim_value());
+        } else if (utils::HasDimParam(dim)) {
+          auto it = symbolic_dim_values.find(dim.dim_param());
+          dims.push_back(it != symbolic_dim_values.end() ? it->second : 1);
+        } else {
+          dims.push_back(1);
+        }
+      }
+    }
+
+    auto element_type = DataTypeImpl::TensorTypeFromONNXEnum(tensor_type.elem_type())->GetElementType();
+    auto p_tensor = std::make_unique<Tensor>(element_type, TensorShape(dims), cpu_allocator);
+    if (!p_tensor->IsDataTypeString() && p_tensor->SizeInBytes() > 0) {
+      memset(p_tensor->MutableDataRaw(), 0, p_tensor->SizeInBytes());
+    }
+
+    OrtValue ort_value;
+    ort_value.Init(p_tensor.release(), DataTypeImpl::GetType<Tensor>(),
+                   DataTypeImpl::GetType<Tensor>()->GetDeleteFunc());
+    feeds.emplace(input_def->Name(), std::move(ort_value));
+  }
+
+  std::vector<std::string> output_names;
+  for (const NodeArg* output_def : model_->MainGraph().GetOutputs()) {
+    output_names.push_back(output_def->Name());
+  }
+
+  RunOptions run_options;
+  run_options.run_tag = "warmup";
+  std::vector<OrtValue> fetches;
+  return Run(run_options, feeds, output_names, &fetches);
+}
+
 std::pair<common::Status, const ModelMetadata*> InferenceSession::GetModelMetadata() const {
   {
     std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
@@ -2144,6 +2279,79 @@ common::Status InferenceSession::NewIOBinding(std::unique_ptr<IOBinding>* io_bin
   return Status::OK();
 }
 
+common::Status InferenceSession::RunAsync(const RunOptions* run_options,
+                                          gsl::span<const char* const> feed_names,
+                                          gsl::span<const OrtValue* const> feeds,
+                                          gsl::span<const char* const> fetch_names,
+                                          gsl::span<OrtValue*> fetches,
+                                          RunAsyncCallbackFn callback, void* user_data) {
+  if (feed_names.size() != feeds.size() || fetch_names.size() != fetches.size()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Mismatch between names and values for feeds or fetches.");
+  }
+
+  auto* inter_op_thread_pool = GetInterOpThreadPoolToUse();
+  if (inter_op_thread_pool == nullptr || concurrency::ThreadPool::DegreeOfParallelism(inter_op_thread_pool) < 2) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                           "RunAsync requires an inter-op thread pool with at least one worker thread. "
+                           "Set the session's inter_op_num_threads to 2 or greater.");
+  }
+
+  // Copy names and input values up front; the caller's arrays of names/values only have
+  // to outlive this call, while the raw output array must stay alive until the callback.
+  std::vector<std::string> feed_name_strings;
+  std::vector<OrtValue> feed_values;
+  feed_name_strings.reserve(feed_names.size());
+  feed_values.reserve(feeds.size());
+  for (size_t i = 0, end = feed_names.size(); i < end; ++i) {
+    if (feed_names[i] == nullptr || feed_names[i][0] == '\0') {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "input name cannot be empty");
+    }
+    feed_name_strings.push_back(feed_names[i]);
+    feed_values.push_back(*feeds[i]);
+  }
+
+  std::vector<std::string> fetch_name_strings;
+  fetch_name_strings.reserve(fetch_names.size());
+  for (size_t i = 0, end = fetch_names.size(); i < end; ++i) {
+    if (fetch_names[i] == nullptr || fetch_names[i][0] == '\0') {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "output name cannot be empty");
+    }
+    fetch_name_strings.push_back(fetch_names[i]);
+  }
+
+  RunOptions run_options_copy = run_options != nullptr ? *run_options : RunOptions();
+  OrtValue** fetch_array = fetches.data();
+  const size_t num_fetches = fetches.size();
+
+  concurrency::ThreadPool::Schedule(
+      inter_op_thread_pool,
+      [this, run_options_copy = std::move(run_options_copy), feed_name_strings = std::move(feed_name_strings),
+       feed_values = std::move(feed_values), fetch_name_strings = std::move(fetch_name_strings), fetch_array,
+       num_fetches, callback, user_data]() {
+        std::vector<OrtValue> fetch_values(num_fetches);
+        for (size_t i = 0; i < num_fetches; ++i) {
+          if (fetch_array[i] != nullptr) {
+            fetch_values[i] = *fetch_array[i];
+          }
+        }
+
+        Status status = Run(run_options_copy, feed_name_strings, feed_values, fetch_name_strings, &fetch_values,
+                            nullptr);
+
+        if (status.IsOK()) {
+          for (size_t i = 0; i < num_fetches; ++i) {
+            if (fetch_array[i] == nullptr) {
+              fetch_array[i] = new OrtValue(fetch_values[i]);
+            }
+          }
+        }
+
+        callback(user_data, fetch_array, status.IsOK() ? num_fetches : 0, ToOrtStatus(status));
+      });
+
+  return Status::OK();
+}
+
 common::Status InferenceSession::Run(const RunOptions& run_options, IOBinding& io_binding) {
   // TODO should Run() call io_binding.SynchronizeInputs() or should it let the callers do it?
   // io_binding.SynchronizeInputs();
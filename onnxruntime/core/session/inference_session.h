@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
 #include <unordered_map>
 
@@ -31,9 +33,7 @@
 #include <TraceLoggingActivity.h>
 #endif
 
-#ifdef ENABLE_TRAINING
 #include "core/framework/partial_graph_execution_state.h"
-#endif
 namespace onnxruntime {  // forward declarations
 class GraphTransformer;
 class Environment;
@@ -105,6 +105,11 @@ struct ModelMetadata {
  *  process the output here...
  */
 
+// Note on sharing state across sessions: independently constructed sessions can
+// already share the environment's allocators and thread pools, a
+// PrepackedWeightsContainer, user-supplied weight OrtValues, and directly used
+// ORT format model bytes. A first-class Clone() would additionally require
+// splitting SessionState's immutable half from its per-session caches.
 class InferenceSession {
  public:
 #if !defined(ORT_MINIMAL_BUILD)
@@ -289,6 +294,17 @@ class InferenceSession {
    */
   common::Status Initialize() ORT_MUST_USE_RESULT;
 
+  /**
+   * Warms up a previously initialized session so the first real request runs at
+   * steady-state latency: touches every initializer page so lazily faulted weights
+   * are resident, then runs the model once over zero-filled inputs to record and
+   * commit the memory pattern for the resulting shape signature.
+   * @param symbolic_dim_values values to substitute for named symbolic dimensions
+   *        in the model inputs. Unlisted symbolic dimensions default to 1.
+   * @return OK if success.
+   */
+  common::Status WarmUp(const std::unordered_map<std::string, int64_t>& symbolic_dim_values = {}) ORT_MUST_USE_RESULT;
+
   common::Status Run(const RunOptions& run_options, const std::vector<std::string>& feed_names,
                      const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
                      std::vector<OrtValue>* p_fetches,
@@ -326,7 +342,29 @@ class InferenceSession {
   virtual common::Status Run(const RunOptions& run_options, IOBinding& io_binding) ORT_MUST_USE_RESULT;
   common::Status Run(IOBinding& io_binding) ORT_MUST_USE_RESULT;
 
-#ifdef ENABLE_TRAINING
+  /**
+   * Run a pre-loaded and pre-initialized model asynchronously on the session's
+   * inter-op thread pool, invoking 'callback' with the fetches when the run
+   * completes. The arrays behind the spans must stay alive until the callback
+   * fires. Requires an inter-op thread pool with at least one worker thread.
+   * @param run_options use this to tune the Run call to your needs. nullptr uses defaults.
+   * @param feed_names names of the inputs, in feeds order.
+   * @param feeds input values owned by client code; must not change until the callback fires.
+   * @param fetch_names output names.
+   * @param fetches output values in fetch_names order. entries may be nullptr, in which
+   *        case the output is allocated by the run and ownership passes to the caller.
+   * @param callback invoked on a thread pool thread once the run completes.
+   * @param user_data opaque pointer passed through to the callback.
+   * @return OK if the run was queued successfully; errors from the run itself are
+   *         reported through the callback's status argument.
+   */
+  common::Status RunAsync(const RunOptions* run_options,
+                          gsl::span<const char* const> feed_names,
+                          gsl::span<const OrtValue* const> feeds,
+                          gsl::span<const char* const> fetch_names,
+                          gsl::span<OrtValue*> fetches,
+                          RunAsyncCallbackFn callback, void* user_data) ORT_MUST_USE_RESULT;
+
   /**
    * Partially run a pre-loaded and pre-intialized model.
    * @param run_options run options.
@@ -345,7 +383,6 @@ class InferenceSession {
                             PartialGraphExecutionState& state,
                             FeedsFetchesManager& feeds_fetches_manager,
                             const OrtValueCachePtr& cache);
-#endif
 
   /**
    * @return pair.first = OK; FAIL otherwise. pair.second is non-NULL when pair.first = OK.
@@ -708,8 +745,40 @@ class InferenceSession {
     TimePoint time_sent_last_;  // the TimePoint of the last report
     // Event Rate per provider < 20 peak events per second
     constexpr static long long kDurationBetweenSending = 1000 * 1000 * 60 * 10;  // duration in (us).  send a report every 10 mins
+
+    // Always-on log2 latency histogram: bucket i counts Run() calls whose
+    // duration was in [2^i, 2^(i+1)) microseconds. Atomic so concurrent Runs
+    // record without a lock; never reset, so percentile drift between
+    // deployments is visible from one snapshot.
+    constexpr static size_t kLatencyHistogramBuckets = 32;
+    std::array<std::atomic<uint64_t>, kLatencyHistogramBuckets> latency_histogram_us_{};
+
+    void RecordRunLatency(long long duration_us) {
+      size_t bucket = 0;
+      unsigned long long value = duration_us > 0 ? static_cast<unsigned long long>(duration_us) : 0;
+      while (value > 1 && bucket + 1 < kLatencyHistogramBuckets) {
+        value >>= 1;
+        ++bucket;
+      }
+      latency_histogram_us_[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
   } telemetry_;
 
+ public:
+  /**
+  Snapshot of the always-on per-session Run() latency histogram: entry i counts
+  completed Runs with duration in [2^i, 2^(i+1)) microseconds.
+  */
+  std::array<uint64_t, Telemetry::kLatencyHistogramBuckets> GetRunLatencyHistogram() const {
+    std::array<uint64_t, Telemetry::kLatencyHistogramBuckets> snapshot{};
+    for (size_t i = 0; i < Telemetry::kLatencyHistogramBuckets; ++i) {
+      snapshot[i] = telemetry_.latency_histogram_us_[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+  }
+
+ private:
+
 #ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
   bool session_activity_started_ = false;
   TraceLoggingActivity<telemetry_provider_handle> session_activity;
@@ -0,0 +1,228 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/request_batcher.h"
+
+#include <chrono>
+#include <cstring>
+
+#include "core/framework/tensor.h"
+#include "core/session/inference_session.h"
+
+namespace onnxruntime {
+
+RequestBatcher::RequestBatcher(InferenceSession& session, const Options& options)
+    : session_(session), options_(options) {
+}
+
+bool RequestBatcher::IsBatchable(const NameMLValMap& feeds, int64_t& batch_count) {
+  batch_count = -1;
+  for (const auto& entry : feeds) {
+    const OrtValue& value = entry.second;
+    if (!value.IsTensor()) return false;
+
+    const Tensor& tensor = value.Get<Tensor>();
+    if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString() ||
+        tensor.Shape().NumDimensions() == 0) {
+      return false;
+    }
+
+    // all feeds of one request must agree on the leading (batch) dimension
+    const int64_t dim0 = tensor.Shape()[0];
+    if (batch_count < 0) {
+      batch_count = dim0;
+    } else if (batch_count != dim0) {
+      return false;
+    }
+  }
+
+  return batch_count > 0;
+}
+
+bool RequestBatcher::IsCompatible(const Batch& batch, const NameMLValMap& feeds,
+                                  const std::vector<std::string>& output_names) {
+  if (batch.output_names != output_names) return false;
+
+  const NameMLValMap& batch_feeds = *batch.requests.front()->feeds;
+  if (batch_feeds.size() != feeds.size()) return false;
+
+  for (const auto& entry : feeds) {
+    auto it = batch_feeds.find(entry.first);
+    if (it == batch_feeds.end()) return false;
+
+    const Tensor& tensor = entry.second.Get<Tensor>();
+    const Tensor& batch_tensor = it->second.Get<Tensor>();
+    if (tensor.DataType() != batch_tensor.DataType()) return false;
+
+    const auto dims = tensor.Shape().GetDims();
+    const auto batch_dims = batch_tensor.Shape().GetDims();
+    if (dims.size() != batch_dims.size()) return false;
+
+    for (size_t i = 1; i < dims.size(); ++i) {
+      if (dims[i] != batch_dims[i]) return false;
+    }
+  }
+
+  return true;
+}
+
+Status RequestBatcher::Run(const RunOptions& run_options, const NameMLValMap& feeds,
+                           const std::vector<std::string>& output_names, std::vector<OrtValue>* fetches) {
+  int64_t batch_count = 0;
+  if (options_.max_batch_size < 2 || !IsBatchable(feeds, batch_count)) {
+    return session_.Run(run_options, feeds, output_names, fetches);
+  }
+
+  PendingRequest request;
+  request.feeds = &feeds;
+  request.fetches = fetches;
+  request.batch_count = batch_count;
+
+  std::unique_lock<OrtMutex> lock(mutex_);
+
+  if (current_batch_ != nullptr && IsCompatible(*current_batch_, feeds, output_names)) {
+    // join the forming batch and wait for its leader to execute it
+    Batch& batch = *current_batch_;
+    batch.requests.push_back(&request);
+    if (batch.requests.size() >= options_.max_batch_size) {
+      batch.closed = true;
+      // hand ownership back to the leader, which re-wraps the raw pointer when
+      // it wakes; resetting the unique_ptr here would destroy the live batch
+      current_batch_.release();
+      cv_.notify_all();  // wake the leader early
+    }
+
+    while (!request.done) {
+      cv_.wait(lock);
+    }
+    return request.status;
+  }
+
+  // become the leader of a new batch. an incompatible in-flight batch keeps forming
+  // independently; this request simply opens the next one.
+  auto owned_batch = std::make_unique<Batch>();
+  owned_batch->run_options = &run_options;
+  owned_batch->output_names = output_names;
+  owned_batch->requests.push_back(&request);
+  Batch* batch = owned_batch.get();
+  current_batch_ = std::move(owned_batch);
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(options_.batch_timeout_us);
+  while (!batch->closed && std::chrono::steady_clock::now() < deadline) {
+    cv_.wait_for(lock, deadline - std::chrono::steady_clock::now());
+  }
+
+  if (!batch->closed) {
+    batch->closed = true;
+    if (current_batch_.get() == batch) {
+      // transfer ownership out of the member without destroying the batch;
+      // it is re-owned by executing_batch below
+      current_batch_.release();
+    }
+  }
+
+  // execute outside the lock so the next batch can form while this one runs.
+  // ownership of the batch (released from current_batch_ on whichever path
+  // closed it) now rests with the leader.
+  std::unique_ptr<Batch> executing_batch(batch);
+  lock.unlock();
+  ExecuteBatch(*executing_batch);
+
+  lock.lock();
+  for (PendingRequest* batched_request : executing_batch->requests) {
+    batched_request->done = true;
+  }
+  cv_.notify_all();
+  return request.status;
+}
+
+void RequestBatcher::ExecuteBatch(const Batch& batch) {
+  const RunOptions& run_options = *batch.run_options;
+
+  // a batch of one needs no gather/scatter
+  if (batch.requests.size() == 1) {
+    PendingRequest& request = *batch.requests.front();
+    request.status = session_.Run(run_options, *request.feeds, batch.output_names, request.fetches);
+    return;
+  }
+
+  int64_t total_count = 0;
+  for (const PendingRequest* request : batch.requests) {
+    total_count += request->batch_count;
+  }
+
+  AllocatorPtr allocator = session_.GetSessionState().GetExecutionProviders().GetDefaultCpuAllocator();
+
+  // gather: concatenate each feed along the leading dimension
+  NameMLValMap batched_feeds;
+  for (const auto& entry : *batch.requests.front()->feeds) {
+    const std::string& name = entry.first;
+    const Tensor& first_tensor = entry.second.Get<Tensor>();
+
+    auto batched_dims = first_tensor.Shape().AsShapeVector();
+    batched_dims[0] = total_count;
+
+    OrtValue batched_value;
+    Tensor::InitOrtValue(first_tensor.DataType(), TensorShape(batched_dims), allocator, batched_value);
+    auto* dst = static_cast<char*>(batched_value.GetMutable<Tensor>()->MutableDataRaw());
+
+    for (const PendingRequest* request : batch.requests) {
+      const Tensor& src = request->feeds->at(name).Get<Tensor>();
+      const size_t bytes = src.SizeInBytes();
+      memcpy(dst, src.DataRaw(), bytes);
+      dst += bytes;
+    }
+
+    batched_feeds.emplace(name, std::move(batched_value));
+  }
+
+  std::vector<OrtValue> batched_fetches;
+  Status status = session_.Run(run_options, batched_feeds, batch.output_names, &batched_fetches);
+
+  if (!status.IsOK()) {
+    for (PendingRequest* request : batch.requests) {
+      request->status = status;
+    }
+    return;
+  }
+
+  // scatter: slice each output back to its request along the leading dimension
+  for (PendingRequest* request : batch.requests) {
+    request->fetches->clear();
+    request->fetches->reserve(batched_fetches.size());
+  }
+
+  for (const OrtValue& batched_output : batched_fetches) {
+    if (!batched_output.IsTensor() || batched_output.Get<Tensor>().IsDataTypeString() ||
+        batched_output.Get<Tensor>().Shape().NumDimensions() == 0 ||
+        batched_output.Get<Tensor>().Shape()[0] != total_count) {
+      Status scatter_error = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                                             "Batched output is not batched along the leading dimension; "
+                                             "this model cannot be used with RequestBatcher.");
+      for (PendingRequest* request : batch.requests) {
+        request->status = scatter_error;
+      }
+      return;
+    }
+
+    const Tensor& batched_tensor = batched_output.Get<Tensor>();
+    const size_t bytes_per_row = static_cast<size_t>(batched_tensor.SizeInBytes() / total_count);
+    const auto* src = static_cast<const char*>(batched_tensor.DataRaw());
+
+    for (PendingRequest* request : batch.requests) {
+      auto dims = batched_tensor.Shape().AsShapeVector();
+      dims[0] = request->batch_count;
+
+      OrtValue sliced_value;
+      Tensor::InitOrtValue(batched_tensor.DataType(), TensorShape(dims), allocator, sliced_value);
+
+      const size_t bytes = bytes_per_row * static_cast<size_t>(request->batch_count);
+      memcpy(sliced_value.GetMutable<Tensor>()->MutableDataRaw(), src, bytes);
+      src += bytes;
+
+      request->fetches->push_back(std::move(sliced_value));
+    }
+  }
+}
+
+}  // namespace onnxruntime
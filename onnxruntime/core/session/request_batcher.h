@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/framework_common.h"
+#include "core/framework/ort_value.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+class InferenceSession;
+
+/**
+ * @brief Aggregates concurrent Run calls into batched executions of a session.
+ *
+ * Callers invoke Run with single-request feeds. Requests arriving within the
+ * configured collection window are concatenated along the batch (leading)
+ * dimension, executed with one InferenceSession::Run, and the batched outputs
+ * are scattered back to the individual callers. This removes the copy and
+ * thread hop an external aggregator pays per request.
+ *
+ * Requests are only batched together when they are shape/type compatible:
+ * identical feed names and output names, identical dimensions except the
+ * leading one, and CPU tensor inputs. Incompatible or non-tensor requests
+ * fall back to an individual Run. The model must accept a dynamic leading
+ * dimension and produce outputs batched along the same dimension.
+ */
+// This aggregator batches within one session. To coalesce Runs across many
+// small sessions instead, share the environment thread pools and submit each
+// Run onto the shared inter-op pool (e.g. via RunAsync) rather than batching.
+class RequestBatcher {
+ public:
+  struct Options {
+    // how long the first request of a batch waits for others to join
+    int64_t batch_timeout_us = 1000;
+    // execute as soon as this many requests have joined the batch
+    size_t max_batch_size = 8;
+  };
+
+  RequestBatcher(InferenceSession& session, const Options& options);
+
+  /**
+   * Run a single request through the aggregator. Blocks until the request's
+   * batch has executed and returns this request's slice of the outputs.
+   * A batch executes with the run options of the request that opened it;
+   * the run options of requests that join an already-forming batch are ignored.
+   */
+  common::Status Run(const RunOptions& run_options, const NameMLValMap& feeds,
+                     const std::vector<std::string>& output_names, std::vector<OrtValue>* fetches);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RequestBatcher);
+
+  struct PendingRequest {
+    const NameMLValMap* feeds;
+    std::vector<OrtValue>* fetches;
+    int64_t batch_count;
+    common::Status status = common::Status::OK();
+    bool done = false;
+  };
+
+  struct Batch {
+    const RunOptions* run_options;
+    std::vector<std::string> output_names;
+    std::vector<PendingRequest*> requests;
+    bool closed = false;
+  };
+
+  // true if 'feeds' can join 'batch' (same names, types, and non-leading dims)
+  static bool IsCompatible(const Batch& batch, const NameMLValMap& feeds,
+                           const std::vector<std::string>& output_names);
+
+  // true if all feeds are CPU tensors with a leading dimension, in which case
+  // 'batch_count' is set to that dimension
+  static bool IsBatchable(const NameMLValMap& feeds, int64_t& batch_count);
+
+  // concatenate, run and scatter. fills in status/fetches of every request.
+  void ExecuteBatch(const Batch& batch);
+
+  InferenceSession& session_;
+  const Options options_;
+
+  OrtMutex mutex_;
+  OrtCondVar cv_;
+  std::unique_ptr<Batch> current_batch_;
+};
+
+}  // namespace onnxruntime
@@ -7,6 +7,12 @@
 #include <memory>
 #include <string>
 
+// Pool sharing note: process-wide intra/inter-op pools already exist
+// via OrtThreadingOptions + CreateEnvWithGlobalThreadPools and sessions opt in
+// with use_per_session_threads=false, so N sessions can share one pool today.
+// "Fairness" between sessions is FIFO over the shared queues; priority or
+// weighted scheduling needs tagging tasks by session at Schedule time and a
+// multi-queue dispatch in ThreadPoolTempl.
 struct OrtThreadPoolParams {
   //0: Use default setting. (All the physical cores or half of the logical cores)
   //1: Don't create thread pool
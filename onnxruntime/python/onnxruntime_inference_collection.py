@@ -409,6 +409,13 @@ class InferenceSession(Session):
         self._create_inference_session(providers, provider_options)
 
 
+# Preallocated numpy outputs already work through this class:
+# bind_output with a preallocated OrtValue (or bind_ortvalue_output over
+# numpy-backed memory) writes results in place, and run_with_iobinding skips
+# output allocation entirely. Arbitrary strides are the actual gap - OrtValue
+# wraps contiguous buffers only, so non-contiguous numpy views must be copied
+# by the caller today; stride support is a Tensor-representation change (the
+# runtime assumes dense row-major layout throughout the kernels).
 class IOBinding:
     '''
     This class provides API to bind input/output to a specified device, e.g. GPU.
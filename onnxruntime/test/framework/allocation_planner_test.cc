@@ -222,6 +222,14 @@ class PlannerTest : public ::testing::Test {
     return (name_to_arg_[name] = &graph_.GetOrCreateNodeArg(name, &float_type_.value));
   }
 
+  // create (or look up) an arg with an explicit type; used by tests that need
+  // non-float values
+  onnxruntime::NodeArg* Arg(const std::string& name, const ONNX_NAMESPACE::TypeProto& type) {
+    auto iter = name_to_arg_.find(name);
+    if (name_to_arg_.end() != iter) return iter->second;
+    return (name_to_arg_[name] = &graph_.GetOrCreateNodeArg(name, &type));
+  }
+
   onnxruntime::Node* AddNode(::onnxruntime::KernelDef& kernel_def, std::string& input, std::string& output) {
     auto node = std::make_unique<UnaryNode>(graph_, kernel_def.OpName(), Arg(input), Arg(output));
     auto* p_node = node->p_node;
@@ -320,6 +328,16 @@ class PlannerTest : public ::testing::Test {
     EXPECT_EQ(plan_->allocation_plan[id].alloc_kind, kind) << "Error in allocation kind for " << name;
   }
 
+  void CheckReused(const std::string& name, const std::string& reused_value) {
+    int id;
+    int reused_id;
+    index(name, id);
+    index(reused_value, reused_id);
+    EXPECT_EQ(plan_->allocation_plan[id].alloc_kind, AllocKind::kReuse) << name << " should reuse a buffer";
+    EXPECT_EQ(plan_->allocation_plan[id].reused_buffer, reused_id)
+        << name << " should reuse the buffer of " << reused_value;
+  }
+
   void CheckFreed(int step_number, std::initializer_list<std::string> freed_items) {
     // create set and check equality
     std::unordered_set<int> expected;
@@ -1053,5 +1071,95 @@ TEST_F(PlannerTest, LocationPlanningForInitializersUsedInMainGraphAndSubgraph) {
 
 #endif
 
+
+// Best-fit reuse: a freed larger buffer is aliased by a later smaller tensor
+// whose shape doesn't match exactly.
+TEST_F(PlannerTest, BestFitReuseSmallerTensorAliasesLargerBuffer) {
+  std::string A("A"), X("X"), B("B"), Y("Y"), Z("Z");
+
+  AddNormalNode(A, X);  // node0: X {100, 100}
+  AddNormalNode(X, B);  // node1: B {100, 100}; X freed afterwards
+  AddNormalNode(B, Y);  // node2: Y {50, 100} - no exact match, best-fits into X
+  AddNormalNode(Y, Z);  // node3
+
+  Shape big_shape{100, 100};
+  Shape small_shape{50, 100};
+  SetShape({{X, &big_shape.value}, {B, &big_shape.value}, {Y, &small_shape.value}, {Z, &small_shape.value}});
+
+  CreatePlan();
+
+  CheckAllocKind(X, AllocKind::kAllocate);
+  CheckAllocKind(B, AllocKind::kAllocate);
+  CheckReused(Y, X);
+  CheckAllocKind(Z, AllocKind::kAllocateOutput);
+}
+
+// An exact shape match must win over a best-fit candidate of equal byte size but
+// different shape.
+TEST_F(PlannerTest, ExactShapeMatchPreferredOverBestFit) {
+  std::string i1("i1"), P("P"), x1("x1"), o1("o1");
+  std::string i2("i2"), Q("Q"), x2("x2"), o2("o2");
+  std::string i3("i3"), T("T"), o3("o3");
+
+  // two chains that retire P {100, 50} and Q {50, 100} - same byte size,
+  // different shapes - before a third chain plans T {50, 100}
+  AddNormalNode(i1, P);   // node0
+  AddNormalNode(P, x1);   // node1: P freed afterwards
+  AddNormalNode(x1, o1);  // node2
+  AddNormalNode(i2, Q);   // node3
+  AddNormalNode(Q, x2);   // node4: Q freed afterwards
+  AddNormalNode(x2, o2);  // node5
+  AddNormalNode(i3, T);   // node6: T must pick the exactly shaped Q, not P
+  AddNormalNode(T, o3);   // node7
+
+  Shape shape_p{100, 50};
+  Shape shape_q{50, 100};
+  Shape shape_small{1, 50};
+  SetShape({{P, &shape_p.value},
+            {x1, &shape_small.value},
+            {o1, &shape_small.value},
+            {Q, &shape_q.value},
+            {x2, &shape_small.value},
+            {o2, &shape_small.value},
+            {T, &shape_q.value},
+            {o3, &shape_q.value}});
+
+  CreatePlan();
+
+  CheckReused(T, Q);
+}
+
+// Best-fit reuse is allowed across element types of equal or compatible byte
+// footprint: an int32 tensor may alias a freed float buffer that covers it.
+TEST_F(PlannerTest, BestFitReuseAcrossElementTypes) {
+  std::string i1("i1"), F("F"), f2("f2"), o1("o1");
+  std::string i2("i2"), G("G"), o2("o2");
+
+  Type int_type;
+  int_type.value.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_INT32);
+  Arg(i2, int_type.value);
+  Arg(G, int_type.value);
+  Arg(o2, int_type.value);
+
+  AddNormalNode(i1, F);   // node0: F {100, 100} float
+  AddNormalNode(F, f2);   // node1: F freed afterwards
+  AddNormalNode(f2, o1);  // node2
+  AddNormalNode(i2, G);   // node3: G {50, 100} int32 best-fits into F's bytes
+  AddNormalNode(G, o2);   // node4
+
+  Shape big_shape{100, 100};
+  Shape tiny_shape{1, 10};
+  Shape g_shape{50, 100};
+  SetShape({{F, &big_shape.value},
+            {f2, &tiny_shape.value},
+            {o1, &tiny_shape.value},
+            {G, &g_shape.value},
+            {o2, &g_shape.value}});
+
+  CreatePlan();
+
+  CheckReused(G, F);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
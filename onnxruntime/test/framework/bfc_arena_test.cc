@@ -47,6 +47,29 @@ TEST(BFCArenaTest, NoDups) {
   CheckStats(&a, 1023, 0, 654336, 1024);
 }
 
+TEST(BFCArenaTest, SmallAllocationCache) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30,
+             BFCArena::DEFAULT_ARENA_EXTEND_STRATEGY,
+             BFCArena::DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+             BFCArena::DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+             /*enable_small_allocation_cache*/ true);
+
+  // a freed small block is served straight back from the size-class cache
+  void* p1 = a.Alloc(1024);
+  ASSERT_NE(p1, nullptr);
+  a.Free(p1);
+  void* p2 = a.Alloc(1024);
+  EXPECT_EQ(p1, p2);
+
+  // a different size class gets a different block
+  void* p3 = a.Alloc(2048);
+  EXPECT_NE(p2, p3);
+
+  a.Free(p2);
+  a.Free(p3);
+}
+
 TEST(BFCArenaTest, AllocationsAndDeallocations) {
   BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
   // Allocate 256 raw pointers of sizes between 100 bytes and about a meg
@@ -3,6 +3,7 @@
 
 #include "core/graph/onnx_protobuf.h"
 #include "core/session/inference_session.h"
+#include "core/session/request_batcher.h"
 
 #include <algorithm>
 #include <cfloat>
@@ -395,6 +396,57 @@ TEST(InferenceSessionTests, NoTimeout) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, WarmUp) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.WarmUp";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // warm-up must succeed and leave the session in a usable state
+  ASSERT_STATUS_OK(session_object.WarmUp());
+
+  RunOptions run_options;
+  run_options.run_tag = "after warmup";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, RequestBatcher) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.RequestBatcher";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RequestBatcher::Options options;
+  options.batch_timeout_us = 100;
+  options.max_batch_size = 4;
+  RequestBatcher batcher(session_object, options);
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &ml_value);
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("X", ml_value));
+
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+
+  // a lone request executes as a batch of one after the collection window expires
+  RunOptions run_options;
+  ASSERT_STATUS_OK(batcher.Run(run_options, feeds, output_names, &fetches));
+
+  std::vector<int64_t> expected_dims_mul_y = {3, 2};
+  std::vector<float> expected_values_mul_y = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+  VerifyOutputs(fetches, expected_dims_mul_y, expected_values_mul_y);
+}
+
 TEST(InferenceSessionTests, OnlyExecutePathToFetches) {
   SessionOptions so;
 
@@ -615,6 +667,62 @@ TEST(InferenceSessionTests, CheckRunLogger) {
 
 // WebAssembly will emit profiling data into console
 #if !defined(__wasm__)
+TEST(InferenceSessionTests, LoweredExecutionPlan) {
+  // the steady-state fast path: the lowered plan must exist after Initialize and
+  // a Run through it must produce the reference results
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.LoweredExecutionPlan";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  const auto& lowered_plan = session_object.GetSessionState().GetLoweredExecutionPlan();
+  ASSERT_FALSE(lowered_plan.empty());
+  ASSERT_EQ(lowered_plan.size(), session_object.GetSessionState().GetExecutionPlan()->execution_plan.size());
+  for (const auto& record : lowered_plan) {
+    ASSERT_NE(record.kernel, nullptr);
+  }
+
+  RunOptions run_options;
+  run_options.run_tag = "lowered plan";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, LoweredExecutionPlanProfilingFallback) {
+  // enabling the profiler must route execution through the reference loop, which
+  // is the only path that emits per-node kernel events - so their presence in the
+  // profile proves the fallback was taken, and RunModel checks the results match
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.LoweredExecutionPlanProfilingFallback";
+  so.enable_profiling = true;
+  so.profile_file_prefix = ORT_TSTR("lowered_plan_fallback_profile");
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "reference loop";
+  RunModel(session_object, run_options);
+
+  std::string profile_file = session_object.EndProfiling();
+  std::ifstream profile(profile_file);
+  ASSERT_TRUE(profile);
+
+  bool has_node_kernel_events = false;
+  std::string line;
+  while (std::getline(profile, line)) {
+    if (line.find("_kernel_time") != std::string::npos) {
+      has_node_kernel_events = true;
+      break;
+    }
+  }
+  ASSERT_TRUE(has_node_kernel_events) << "profiled run should have used the reference loop";
+}
+
 TEST(InferenceSessionTests, CheckRunProfilerWithSessionOptions) {
   SessionOptions so;
 
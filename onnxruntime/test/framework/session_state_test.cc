@@ -774,6 +774,76 @@ TEST(SessionStateTest, SharedInitalizersWithPrePackingTest) {
     // Assert this.
     ASSERT_EQ(session_state_2.GetUsedSharedPrePackedWeightCounter(), static_cast<size_t>(1));
   }
+
+  // Part 4: Pre-packing enabled + pre-packed weights container + no shared initializers =
+  // pre-packed weights caching still enabled (the cache is content-addressed, so identical
+  // graph initializers de-dupe across sessions without being registered via AddInitializer)
+  {
+    SessionOptions sess_options;
+    // Enable pre-packing
+    sess_options.config_options.configurations[kOrtSessionOptionsConfigDisablePrepacking] = "0";
+
+    // Enable pre-packed weights container
+    PrepackedWeightsContainer prepacked_weights_container;
+
+    // First session/model
+    Model model_1("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                  domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                  DefaultLoggingManager().DefaultLogger());
+
+    CreateSimpleGraph(model_1.MainGraph());
+    PlaceAllNodesToCPUEP(model_1.MainGraph());
+    SessionState session_state_1(model_1.MainGraph(),
+                                 execution_providers,
+                                 true, /*enable_mem_pattern*/
+                                 tp.get(),
+                                 nullptr, /*inter_op_thread_pool*/
+                                 dtm,
+                                 DefaultLoggingManager().DefaultLogger(),
+                                 profiler,
+                                 false, true,
+                                 &prepacked_weights_container);
+
+    ASSERT_STATUS_OK(session_state_1.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                          kernel_registry_manager,
+                                                          sess_options));
+
+    const auto* kernel = reinterpret_cast<const PrePackingTestOpKernel*>(session_state_1.GetKernel(0));
+    ASSERT_EQ(session_state_1.GetNumberOfPrepacksCounter(), static_cast<size_t>(1));
+    ASSERT_EQ(kernel->prepack_calls_count, 1);
+    ASSERT_EQ(kernel->store_pre_packed_weight_calls_count, 1);
+    // first session populates the cache
+    ASSERT_EQ(session_state_1.GetUsedSharedPrePackedWeightCounter(), static_cast<size_t>(0));
+
+    // Second session/model
+    Model model_2("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                  domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                  DefaultLoggingManager().DefaultLogger());
+
+    CreateSimpleGraph(model_2.MainGraph());
+    PlaceAllNodesToCPUEP(model_2.MainGraph());
+    SessionState session_state_2(model_2.MainGraph(),
+                                 execution_providers,
+                                 true, /*enable_mem_pattern*/
+                                 tp.get(),
+                                 nullptr, /*inter_op_thread_pool*/
+                                 dtm,
+                                 DefaultLoggingManager().DefaultLogger(),
+                                 profiler,
+                                 false, true,
+                                 &prepacked_weights_container);
+
+    ASSERT_STATUS_OK(session_state_2.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                          kernel_registry_manager,
+                                                          sess_options));
+
+    kernel = reinterpret_cast<const PrePackingTestOpKernel*>(session_state_2.GetKernel(0));
+    ASSERT_EQ(session_state_2.GetNumberOfPrepacksCounter(), static_cast<size_t>(1));
+    ASSERT_EQ(kernel->prepack_calls_count, 1);
+    ASSERT_EQ(kernel->store_pre_packed_weight_calls_count, 1);
+    // the second session's identical initializer content resolves to the cached copy
+    ASSERT_EQ(session_state_2.GetUsedSharedPrePackedWeightCounter(), static_cast<size_t>(1));
+  }
 }
 
 INSTANTIATE_TEST_SUITE_P(SessionStateTests,
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "mlas.h"
+#include "bench_util.h"
+
+#include <stdexcept>
+
+//
+// Benchmarks for the vectorized transcendental kernels. These dominate softmax
+// and GELU heavy models, so tracking them per drop catches kernel-tier
+// regressions without running full models.
+//
+
+static const std::vector<std::string> compute_bench_arg_names = {"N"};
+
+template <void MLASCALL Kernel(const float*, float*, size_t)>
+void COMPUTE_UNARY(benchmark::State& state) {
+  if (state.range(0) <= 0) throw std::invalid_argument("N must greater than 0!");
+  const size_t N = static_cast<size_t>(state.range(0));
+
+  auto input = RandomVectorUniform(N, -3.0f, 3.0f);
+  std::vector<float> output(N);
+
+  Kernel(input.data(), output.data(), N);
+  for (auto _ : state) {
+    Kernel(input.data(), output.data(), N);
+  }
+}
+
+void SOFTMAX(benchmark::State& state, bool log_softmax) {
+  if (state.range(0) <= 0) throw std::invalid_argument("BatchCount must greater than 0!");
+  if (state.range(1) <= 0) throw std::invalid_argument("D must greater than 0!");
+  const size_t BatchCount = static_cast<size_t>(state.range(0));
+  const size_t D = static_cast<size_t>(state.range(1));
+
+  auto input = RandomVectorUniform(BatchCount * D, -3.0f, 3.0f);
+  std::vector<float> output(BatchCount * D);
+
+  MlasComputeSoftmax(input.data(), output.data(), BatchCount, D, log_softmax, nullptr);
+  for (auto _ : state) {
+    MlasComputeSoftmax(input.data(), output.data(), BatchCount, D, log_softmax, nullptr);
+  }
+}
+
+static void ComputeSizeArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames(compute_bench_arg_names);
+  for (int64_t n : {1024, 16384, 262144, 1048576}) {
+    b->Args({n});
+  }
+}
+
+BENCHMARK_TEMPLATE(COMPUTE_UNARY, MlasComputeExp)->Apply(ComputeSizeArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(COMPUTE_UNARY, MlasComputeErf)->Apply(ComputeSizeArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(COMPUTE_UNARY, MlasComputeTanh)->Apply(ComputeSizeArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(COMPUTE_UNARY, MlasComputeLogistic)->Apply(ComputeSizeArgs)->UseRealTime();
+
+BENCHMARK_CAPTURE(SOFTMAX, Softmax, false)
+    ->ArgNames({"BatchCount", "D"})
+    ->Args({32, 1000})
+    ->Args({32, 30528})
+    ->Args({256, 1000})
+    ->Args({256, 30528})
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(SOFTMAX, LogSoftmax, true)
+    ->ArgNames({"BatchCount", "D"})
+    ->Args({32, 1000})
+    ->Args({256, 30528})
+    ->UseRealTime();
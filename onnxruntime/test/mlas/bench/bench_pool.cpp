@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "mlas.h"
+#include "bench_util.h"
+
+#include <stdexcept>
+
+//
+// Benchmarks for the NCHW pooling kernels across the common detection /
+// classification geometries.
+//
+
+static const std::vector<std::string> pool_bench_arg_names = {"N", "C", "H", "W", "Kernel", "Stride"};
+
+void POOL(benchmark::State& state, MLAS_POOLING_KIND kind) {
+  const int64_t N = state.range(0);
+  const int64_t C = state.range(1);
+  const int64_t H = state.range(2);
+  const int64_t W = state.range(3);
+  const int64_t kernel = state.range(4);
+  const int64_t stride = state.range(5);
+  if (N <= 0 || C <= 0 || H <= 0 || W <= 0 || kernel <= 0 || stride <= 0) {
+    throw std::invalid_argument("all arguments must be greater than 0!");
+  }
+
+  const int64_t input_shape[] = {N, C, H, W};
+  const int64_t kernel_shape[] = {kernel, kernel};
+  const int64_t padding[] = {0, 0, 0, 0};
+  const int64_t stride_shape[] = {stride, stride};
+  const int64_t output_h = (H - kernel) / stride + 1;
+  const int64_t output_w = (W - kernel) / stride + 1;
+  const int64_t output_shape[] = {N, C, output_h, output_w};
+  if (output_h <= 0 || output_w <= 0) {
+    throw std::invalid_argument("kernel/stride do not fit the input!");
+  }
+
+  auto input = RandomVectorUniform(static_cast<size_t>(N * C * H * W), -1.0f, 1.0f);
+  std::vector<float> output(static_cast<size_t>(N * C * output_h * output_w));
+
+  MlasPool(kind, 2, input_shape, kernel_shape, padding, stride_shape, output_shape,
+           input.data(), output.data(), nullptr);
+  for (auto _ : state) {
+    MlasPool(kind, 2, input_shape, kernel_shape, padding, stride_shape, output_shape,
+             input.data(), output.data(), nullptr);
+  }
+}
+
+static void PoolShapeArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames(pool_bench_arg_names);
+  // {N, C, H, W, kernel, stride}
+  b->Args({1, 64, 112, 112, 3, 2});
+  b->Args({1, 256, 56, 56, 2, 2});
+  b->Args({32, 64, 112, 112, 3, 2});
+  b->Args({32, 512, 28, 28, 2, 2});
+}
+
+BENCHMARK_CAPTURE(POOL, Maximum, MlasMaximumPooling)->Apply(PoolShapeArgs)->UseRealTime();
+BENCHMARK_CAPTURE(POOL, AverageExcludePad, MlasAveragePoolingExcludePad)->Apply(PoolShapeArgs)->UseRealTime();
+BENCHMARK_CAPTURE(POOL, AverageIncludePad, MlasAveragePoolingIncludePad)->Apply(PoolShapeArgs)->UseRealTime();
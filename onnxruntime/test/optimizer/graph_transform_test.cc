@@ -12,6 +12,7 @@
 #include "gmock/gmock.h"
 
 #include "asserts.h"
+#include "graph_transform_test_builder.h"
 #include "core/common/span_utils.h"
 #include "core/framework/data_types.h"
 #include "core/framework/ort_value.h"
@@ -32,6 +33,7 @@
 #include "core/optimizer/conv_bn_fusion.h"
 #include "core/optimizer/conv_mul_fusion.h"
 #include "core/optimizer/div_mul_fusion.h"
+#include "core/optimizer/elementwise_chain_fusion.h"
 #include "core/optimizer/dropout_elimination.h"
 #include "core/optimizer/dynamic_quantize_matmul_fusion.h"
 #include "core/optimizer/embed_layer_norm_fusion.h"
@@ -650,6 +652,42 @@ TEST_F(GraphTransformationTests, DivMulFusion) {
   ASSERT_TRUE(op_to_count["Mul"] == 2);
 }
 
+#ifndef DISABLE_CONTRIB_OPS
+TEST_F(GraphTransformationTests, ElementwiseChainFusion) {
+  // Mul(x, 0.5) -> Sigmoid -> Sub(., 1.0) -> Tanh should collapse to a single FusedElementwise node.
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({2, 3, 8}, -1.0f, 1.0f);
+    auto* mul_out = builder.MakeIntermediate();
+    auto* sigmoid_out = builder.MakeIntermediate();
+    auto* sub_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("Mul", {input_arg, builder.MakeScalarInitializer<float>(0.5f)}, {mul_out});
+    builder.AddNode("Sigmoid", {mul_out}, {sigmoid_out});
+    builder.AddNode("Sub", {sigmoid_out, builder.MakeScalarInitializer<float>(1.0f)}, {sub_out});
+    builder.AddNode("Tanh", {sub_out}, {output_arg});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Mul"], 0);
+    EXPECT_EQ(op_to_count["Sigmoid"], 0);
+    EXPECT_EQ(op_to_count["Sub"], 0);
+    EXPECT_EQ(op_to_count["Tanh"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 1);
+  };
+
+  TransformerTester(build_test_case,
+                    check_graph,
+                    TransformerLevel::Level1,
+                    TransformerLevel::Level2,
+                    12 /*opset_version*/,
+                    1e-6 /*per_sample_tolerance*/,
+                    1e-6 /*relative_per_sample_tolerance*/,
+                    std::make_unique<ElementwiseChainFusion>());
+}
+#endif  // !DISABLE_CONTRIB_OPS
+
 TEST_F(GraphTransformationTests, NotWhereFusion) {
   auto model_uri = MODEL_FOLDER "fusion/not_where.onnx";
   std::shared_ptr<Model> model;
@@ -39,6 +39,16 @@ struct PerformanceResult {
   void DumpToFile(const std::basic_string<ORTCHAR_T>& path, bool f_include_statistics = false) const;
 };
 
+// Scope notes: this runner drives exactly one model per process.
+// Mixed-workload interference measurement (N models sharing pools and arenas
+// with per-model percentiles) composes from multiple runner instances over
+// shared env resources; owning the workload mix and scheduling is left to
+// harness scripts.
+//
+// A/B comparison across optimization levels or EP configs is likewise two runs
+// with different -o/-e flags plus offline statistical comparison of the dumped
+// per-request latencies; the runner intentionally ships the raw outputs rather
+// than the comparison.
 class PerformanceRunner {
  public:
   PerformanceRunner(Ort::Env& env, const PerformanceTestConfig& test_config, std::random_device& rd);
@@ -88,6 +98,7 @@ class PerformanceRunner {
   Status RepeatedTimesTest();
   Status ForkJoinRepeat();
   Status RunParallelDuration();
+  Status RunOpenLoop();
 
   inline Status RunFixDuration() {
     while (performance_result_.total_time_cost < performance_test_config_.run_config.duration_in_seconds) {
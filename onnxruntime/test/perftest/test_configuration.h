@@ -41,6 +41,11 @@ struct RunConfig {
   size_t repeated_times{1000};
   size_t duration_in_seconds{600};
   size_t concurrent_session_runs{1};
+  // > 0 selects open-loop load generation in duration mode: one request is
+  // issued every 1/target_qps seconds regardless of completions, so queueing
+  // delay shows up in the recorded latencies (latency under load) instead of
+  // being absorbed by the closed loop.
+  double target_qps{0.0};
   bool f_dump_statistics{false};
   bool f_verbose{false};
   bool enable_memory_pattern{true};
@@ -5,6 +5,7 @@
 #include "test/providers/provider_test_utils.h"
 #include "test/common/cuda_op_test_utils.h"
 #include "default_providers.h"
+#include "test/util/include/scoped_env_vars.h"
 
 namespace onnxruntime {
 namespace test {
@@ -295,5 +296,84 @@ TEST(MathOpTest, MatMulSharedPrepackedWeights) {
 
 #endif
 
+
+// Exercises the opt-in block-sparse weight path (ORT_MATMUL_SPARSE_WEIGHTS=1):
+// B is a >= 80% sparse constant initializer above the size threshold, so PrePack
+// lowers it to the flattened block-CSR form; results must match the dense
+// reference computed here with plain loops.
+namespace {
+
+void BuildSparseMatMulCase(int64_t M, int64_t K, int64_t N, bool batched_a,
+                           std::vector<int64_t>& a_dims, std::vector<float>& a_vals,
+                           std::vector<float>& b_vals,
+                           std::vector<int64_t>& y_dims, std::vector<float>& y_vals) {
+  const int64_t batch = batched_a ? 2 : 1;
+  a_dims = batched_a ? std::vector<int64_t>{batch, M, K} : std::vector<int64_t>{M, K};
+  y_dims = batched_a ? std::vector<int64_t>{batch, M, N} : std::vector<int64_t>{M, N};
+
+  a_vals.resize(static_cast<size_t>(batch * M * K));
+  for (size_t i = 0; i < a_vals.size(); ++i) {
+    a_vals[i] = static_cast<float>((i % 7)) - 3.0f;
+  }
+
+  // ~6% density: one nonzero per 16 elements plus an irregular stripe
+  b_vals.assign(static_cast<size_t>(K * N), 0.0f);
+  for (int64_t k = 0; k < K; ++k) {
+    for (int64_t n = k % 16; n < N; n += 16) {
+      b_vals[static_cast<size_t>(k * N + n)] = static_cast<float>(((k + n) % 5)) - 2.0f;
+    }
+  }
+
+  y_vals.assign(static_cast<size_t>(batch * M * N), 0.0f);
+  for (int64_t b = 0; b < batch; ++b) {
+    for (int64_t m = 0; m < M; ++m) {
+      for (int64_t n = 0; n < N; ++n) {
+        float sum = 0.0f;
+        for (int64_t k = 0; k < K; ++k) {
+          sum += a_vals[static_cast<size_t>((b * M + m) * K + k)] * b_vals[static_cast<size_t>(k * N + n)];
+        }
+        y_vals[static_cast<size_t>((b * M + m) * N + n)] = sum;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(MathOpTest, MatMulSparseWeight2D) {
+  ScopedEnvironmentVariables scoped_env_vars(EnvVarMap{{"ORT_MATMUL_SPARSE_WEIGHTS", "1"}});
+
+  constexpr int64_t M = 3, K = 64, N = 256;  // K * N == 16384, the path's size floor
+  std::vector<int64_t> a_dims, y_dims;
+  std::vector<float> a_vals, b_vals, y_vals;
+  BuildSparseMatMulCase(M, K, N, /*batched_a*/ false, a_dims, a_vals, b_vals, y_dims, y_vals);
+
+  OpTester test("MatMul");
+  test.AddInput<float>("A", a_dims, a_vals);
+  test.AddInput<float>("B", {K, N}, b_vals, /*is_initializer*/ true);
+  test.AddOutput<float>("Y", y_dims, y_vals);
+  // the sparse kernel is CPU-only behavior; restrict to the CPU EP
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kCudaExecutionProvider,
+                                                        kRocmExecutionProvider, kOpenVINOExecutionProvider,
+                                                        kDnnlExecutionProvider});
+}
+
+TEST(MathOpTest, MatMulSparseWeightBatchedA) {
+  ScopedEnvironmentVariables scoped_env_vars(EnvVarMap{{"ORT_MATMUL_SPARSE_WEIGHTS", "1"}});
+
+  constexpr int64_t M = 5, K = 64, N = 256;
+  std::vector<int64_t> a_dims, y_dims;
+  std::vector<float> a_vals, b_vals, y_vals;
+  BuildSparseMatMulCase(M, K, N, /*batched_a*/ true, a_dims, a_vals, b_vals, y_dims, y_vals);
+
+  OpTester test("MatMul");
+  test.AddInput<float>("A", a_dims, a_vals);
+  test.AddInput<float>("B", {K, N}, b_vals, /*is_initializer*/ true);
+  test.AddOutput<float>("Y", y_dims, y_vals);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kCudaExecutionProvider,
+                                                        kRocmExecutionProvider, kOpenVINOExecutionProvider,
+                                                        kDnnlExecutionProvider});
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "gmock/gmock.h"
+#include <algorithm>
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/common/cuda_op_test_utils.h"
@@ -861,5 +864,38 @@ TEST(TopKOperator, SelectTopKThreaded) {
   TestThreaded<double>(k, n, batch_size);
 }
 
+
+// Crosses the partitioned-selection thresholds (single row, last axis with
+// >= 256K entries, large k): the column space is sharded, each shard
+// quickselects locally, and a merge pass picks the final k. Expected results
+// are computed with a full sort over distinct values so any selection or
+// ordering error in the partitioned path shows up.
+TEST(TopKOperator, LargeVocabularyPartitionedSelection) {
+  constexpr int64_t num_entries = 400 * 1024;
+  constexpr int64_t k = 1000;
+
+  // distinct pseudo-random permutation of [0, num_entries)
+  std::vector<float> input_vals(num_entries);
+  for (int64_t i = 0; i < num_entries; ++i) {
+    input_vals[i] = static_cast<float>((static_cast<uint64_t>(i) * 2654435761ULL) % num_entries);
+  }
+
+  std::vector<int64_t> order(num_entries);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&input_vals](int64_t lhs, int64_t rhs) {
+    return input_vals[lhs] > input_vals[rhs];
+  });
+
+  std::vector<float> expected_vals(k);
+  std::vector<int64_t> expected_indices(k);
+  for (int64_t i = 0; i < k; ++i) {
+    expected_vals[i] = input_vals[order[i]];
+    expected_indices[i] = order[i];
+  }
+
+  RunTest(11, k, input_vals, {num_entries}, expected_vals, expected_indices, {k},
+          /*is_tensorrt_supported*/ false, /*axis*/ 0);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
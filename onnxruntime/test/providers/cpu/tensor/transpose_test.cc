@@ -650,5 +650,50 @@ TEST(TransposeOpTest, Transpose0312) {  // Will trigger Transpose3DImpl() becaus
 
 #endif
 
+
+// Exercises the generic rank-N transpose (DoTransposeImpl): the prefix
+// permutation swaps two independent axis pairs (not a single-axis move) and the
+// trailing axis is an identity suffix, so the sharded block loop with
+// seeded multi-index state runs. Expected values are computed with plain loops.
+TEST(TransposeOpTest, GenericPermutationShardedBlocks) {
+  const std::vector<int64_t> input_shape{4, 3, 5, 2, 8};
+  const std::vector<int64_t> perm{1, 0, 3, 2, 4};
+  const std::vector<int64_t> output_shape{3, 4, 2, 5, 8};
+
+  const int64_t num_elements = 4 * 3 * 5 * 2 * 8;
+  std::vector<float> input_vals(num_elements);
+  for (int64_t i = 0; i < num_elements; ++i) {
+    input_vals[i] = static_cast<float>(i) * 0.5f - 100.0f;
+  }
+
+  // reference transpose with explicit index arithmetic
+  std::vector<float> expected_vals(num_elements);
+  const int64_t in_strides[5] = {3 * 5 * 2 * 8, 5 * 2 * 8, 2 * 8, 8, 1};
+  int64_t out_index = 0;
+  for (int64_t d0 = 0; d0 < output_shape[0]; ++d0) {
+    for (int64_t d1 = 0; d1 < output_shape[1]; ++d1) {
+      for (int64_t d2 = 0; d2 < output_shape[2]; ++d2) {
+        for (int64_t d3 = 0; d3 < output_shape[3]; ++d3) {
+          for (int64_t d4 = 0; d4 < output_shape[4]; ++d4) {
+            const int64_t in_coord[5] = {d1, d0, d3, d2, d4};  // inverse of perm
+            int64_t in_index = 0;
+            for (int64_t axis = 0; axis < 5; ++axis) {
+              in_index += in_coord[axis] * in_strides[axis];
+            }
+            expected_vals[out_index++] = input_vals[in_index];
+          }
+        }
+      }
+    }
+  }
+
+  OpTester test("Transpose");
+  std::vector<int64_t> perm_attr = perm;
+  test.AddAttribute("perm", perm_attr);
+  test.AddInput<float>("X", input_shape, input_vals);
+  test.AddOutput<float>("Y", output_shape, expected_vals);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 }  // namespace test
 }  // namespace onnxruntime
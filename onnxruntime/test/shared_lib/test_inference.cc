@@ -9,6 +9,7 @@
 #include <atomic>
 #include <mutex>
 #include <algorithm>
+#include <future>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -371,6 +372,56 @@ TEST(CApiTest, SparseInputModel) {
 #endif  // DISABLE_CONTRIB_OPS
 #endif  // !defined(DISABLE_SPARSE_TENSORS)
 
+namespace {
+struct RunAsyncTestState {
+  std::promise<OrtStatusPtr> done;
+};
+
+void RunAsyncTestCallback(void* user_data, OrtValue** /*outputs*/, size_t /*num_outputs*/, OrtStatusPtr status) {
+  static_cast<RunAsyncTestState*>(user_data)->done.set_value(status);
+}
+}  // namespace
+
+TEST(CApiTest, run_async) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(1);
+  session_options.SetInterOpNumThreads(2);
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  std::vector<int64_t> x_shape{3, 2};
+  std::vector<float> x_values{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  std::vector<float> expected_y{1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  Ort::Value input = Ort::Value::CreateTensor(info, x_values.data(), x_values.size(),
+                                              x_shape.data(), x_shape.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  const OrtValue* inputs[] = {input};
+  OrtValue* output = nullptr;
+
+  RunAsyncTestState state;
+  auto done = state.done.get_future();
+  Ort::ThrowOnError(Ort::GetApi().RunAsync(session, nullptr, input_names, inputs, 1, output_names, 1, &output,
+                                           RunAsyncTestCallback, &state));
+
+  ASSERT_EQ(done.wait_for(std::chrono::seconds(30)), std::future_status::ready);
+  OrtStatusPtr status = done.get();
+  if (status != nullptr) {
+    std::string error_message = Ort::GetApi().GetErrorMessage(status);
+    Ort::GetApi().ReleaseStatus(status);
+    FAIL() << error_message;
+  }
+  ASSERT_NE(output, nullptr);
+
+  Ort::Value output_value{output};
+  const auto* y_values = output_value.GetTensorData<float>();
+  for (size_t i = 0; i < expected_y.size(); ++i) {
+    ASSERT_EQ(y_values[i], expected_y[i]);
+  }
+}
+
 TEST(CApiTest, custom_op_handler) {
   std::cout << "Running custom op inference" << std::endl;
 
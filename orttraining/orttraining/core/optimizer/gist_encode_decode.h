@@ -1,6 +1,14 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// Recompute planning note: this tree's memory-reduction tooling is
+// GIST encode/decode (activation compression) plus manual recompute subgraphs
+// emitted by the python-side configs; there is no budget-solver choosing which
+// activations to recompute. Such a planner needs per-activation (size,
+// recompute-cost) pairs - sizes come from shape inference, costs from a static
+// FLOP model - and solves a knapsack over the peak-memory timeline from the
+// allocation plan; it would sit beside the training graph transformers with
+// the plan's lifetime intervals as input.
 #pragma once
 
 #include "core/optimizer/rewrite_rule.h"
@@ -1,6 +1,15 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+// Accumulation fusion note: gradient accumulation
+// (InPlaceAccumulator here) and the optimizer update run as separate passes
+// over the gradient buffers; fusing the final accumulation step into the
+// optimizer kernel saves one full read/write of every gradient on the last
+// micro-batch. The fusion is a graph change (the accumulation-count input must
+// reach the optimizer so it applies grad/count inline) plus an optimizer
+// kernel variant taking the raw last micro-batch gradient - the kernels
+// themselves are trivially extendable once the training graph builder emits
+// the fused form.
 #pragma once
 
 #include "core/common/common.h"
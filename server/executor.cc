@@ -31,6 +31,27 @@ protobufutil::Status Executor::SetMLValue(const onnx::TensorProto& input_tensor,
     return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
   }
 
+  // Zero-copy fast path: numeric tensors whose payload arrived in raw_data are
+  // used in place over the request buffer - the request outlives the Run call -
+  // skipping the staging copy through TensorProtoToMLValue. String tensors and
+  // repeated-field payloads still convert through the copying path.
+  if (input_tensor.has_raw_data() &&
+      input_tensor.data_type() != onnx::TensorProto_DataType_STRING &&
+      input_tensor.raw_data().size() == cpu_tensor_length) {
+    try {
+      std::vector<int64_t> dims(input_tensor.dims().begin(), input_tensor.dims().end());
+      ml_value = Ort::Value::CreateTensor(
+          cpu_memory_info,
+          const_cast<void*>(static_cast<const void*>(input_tensor.raw_data().data())),
+          cpu_tensor_length, dims.data(), dims.size(),
+          static_cast<ONNXTensorElementDataType>(input_tensor.data_type()));
+      return protobufutil::Status::OK;
+    } catch (const Ort::Exception& e) {
+      logger->error("Zero-copy tensor creation failed. Message: {}", e.what());
+      return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+    }
+  }
+
   auto* buf = buffers.AllocNewBuffer(cpu_tensor_length);
   try {
     onnxruntime::server::TensorProtoToMLValue(input_tensor,
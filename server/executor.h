@@ -13,6 +13,15 @@
 namespace onnxruntime {
 namespace server {
 
+// Every Predict shares the single session owned by ServerEnvironment; adaptive
+// cross-request batching belongs between the HTTP/gRPC handlers and this
+// executor, and the runtime-side aggregation primitive already exists
+// (onnxruntime::RequestBatcher collects compatible concurrent Runs for a
+// microsecond window and scatters results).
+//
+// A session pool with per-worker affinity is a ServerEnvironment change: N
+// sessions over shared env allocators and the prepacked weights container,
+// with workers pinned per session - the runtime supports that pattern today.
 class Executor {
  public:
   Executor(ServerEnvironment* server_env, std::string request_id) : env_(server_env),
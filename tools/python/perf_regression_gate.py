@@ -0,0 +1,90 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+"""
+Regression gate over benchmark output: compares a candidate run against a
+baseline and exits non-zero when any metric regresses beyond the threshold.
+
+Two input formats are supported, covering the repo's benchmark tooling:
+
+* google-benchmark JSON (onnxruntime_mlas_benchmark --benchmark_format=json):
+  compared per benchmark name on real_time.
+* onnxruntime_perf_test per-request dump (the CSV written with -d, one latency
+  per line in column 2): compared on the P50/P90/P99 of the latency samples.
+
+Typical CI usage over a checked-in model zoo: run the benchmarks per model for
+the baseline and candidate builds, store the outputs, then gate:
+
+  python perf_regression_gate.py baseline.json candidate.json --threshold-pct 5
+  python perf_regression_gate.py baseline.csv candidate.csv --threshold-pct 10
+"""
+
+import argparse
+import json
+import sys
+
+
+def _load_metrics(path):
+    """Returns {metric_name: value} for either supported format."""
+    with open(path) as f:
+        content = f.read()
+
+    try:
+        data = json.loads(content)
+    except ValueError:
+        data = None
+
+    if isinstance(data, dict) and "benchmarks" in data:
+        return {bench["name"]: float(bench["real_time"]) for bench in data["benchmarks"]}
+
+    # perf_test per-request dump: model_name,latency,... one line per request
+    latencies = []
+    for line in content.splitlines():
+        fields = line.split(",")
+        if len(fields) >= 2:
+            try:
+                latencies.append(float(fields[1]))
+            except ValueError:
+                continue
+    if not latencies:
+        raise ValueError(f"{path}: not google-benchmark JSON and no latency samples found")
+
+    latencies.sort()
+
+    def percentile(p):
+        return latencies[min(len(latencies) - 1, int(len(latencies) * p))]
+
+    return {"P50": percentile(0.5), "P90": percentile(0.9), "P99": percentile(0.99)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="baseline benchmark output (JSON or per-request CSV)")
+    parser.add_argument("candidate", help="candidate benchmark output in the same format")
+    parser.add_argument("--threshold-pct", type=float, default=5.0,
+                        help="fail when a metric is more than this percent slower than baseline (default 5)")
+    args = parser.parse_args()
+
+    baseline = _load_metrics(args.baseline)
+    candidate = _load_metrics(args.candidate)
+
+    regressions = []
+    for name, base_value in sorted(baseline.items()):
+        if name not in candidate or base_value <= 0:
+            continue
+        cand_value = candidate[name]
+        delta_pct = 100.0 * (cand_value - base_value) / base_value
+        marker = "REGRESSION" if delta_pct > args.threshold_pct else "ok"
+        print(f"{name:60s} {base_value:14.3f} -> {cand_value:14.3f}  {delta_pct:+7.2f}%  {marker}")
+        if delta_pct > args.threshold_pct:
+            regressions.append(name)
+
+    if regressions:
+        print(f"\n{len(regressions)} metric(s) regressed beyond {args.threshold_pct}%", file=sys.stderr)
+        return 1
+
+    print("\nno regressions beyond threshold")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
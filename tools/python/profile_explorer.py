@@ -0,0 +1,85 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+"""
+Analyze an ONNX Runtime profiler trace (the JSON written when profiling is
+enabled on a session): aggregate node kernel time by op type, list the top
+nodes, and emit collapsed stack lines suitable for flamegraph.pl / speedscope.
+
+The "critical path" of a sequential execution is simply its node time ordering,
+so the top-node listing doubles as the critical-path report for single-stream
+runs; for parallel executors the per-op aggregation remains valid while true
+critical-path extraction would need dependency edges, which the trace does not
+record.
+
+Usage:
+  python profile_explorer.py profile.json
+  python profile_explorer.py profile.json --collapsed > stacks.txt  # flamegraph input
+  python profile_explorer.py profile.json --top 50
+"""
+
+import argparse
+import collections
+import json
+import sys
+
+
+def _load_events(path):
+    with open(path) as f:
+        data = json.load(f)
+    # traces are either a bare list or {"traceEvents": [...]}
+    if isinstance(data, dict):
+        data = data.get("traceEvents", [])
+    return data
+
+
+def _node_events(events):
+    for event in events:
+        if event.get("cat") == "Node" and event.get("name", "").endswith("_kernel_time"):
+            yield event
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("profile", help="profile JSON written by the ORT profiler")
+    parser.add_argument("--top", type=int, default=20, help="number of nodes to list (default 20)")
+    parser.add_argument(
+        "--collapsed",
+        action="store_true",
+        help="emit collapsed 'op_type;node_name duration_us' stack lines for flamegraph tooling instead of the report",
+    )
+    args = parser.parse_args()
+
+    events = list(_node_events(_load_events(args.profile)))
+    if not events:
+        print("no node kernel events found - was the session run with profiling enabled?", file=sys.stderr)
+        return 1
+
+    by_op_type = collections.Counter()
+    by_node = collections.Counter()
+    for event in events:
+        op_type = event.get("args", {}).get("op_name", "<unknown>")
+        duration = event.get("dur", 0)
+        by_op_type[op_type] += duration
+        by_node[(op_type, event["name"][: -len("_kernel_time")])] += duration
+
+    if args.collapsed:
+        for (op_type, node_name), duration in by_node.most_common():
+            print(f"{op_type};{node_name} {duration}")
+        return 0
+
+    total = sum(by_op_type.values())
+    print(f"total node kernel time: {total} us over {len(events)} events\n")
+
+    print("time by op type:")
+    for op_type, duration in by_op_type.most_common():
+        print(f"  {op_type:30s} {duration:12d} us  {100.0 * duration / total:5.1f}%")
+
+    print(f"\ntop {args.top} nodes (the critical path of a sequential run):")
+    for (op_type, node_name), duration in by_node.most_common(args.top):
+        print(f"  {duration:12d} us  {op_type:20s} {node_name}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())